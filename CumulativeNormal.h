@@ -0,0 +1,180 @@
+#pragma once
+/*
+ * Forward normal distribution: Phi, Q = 1 - Phi, phi and log Phi.
+ *
+ * Built on the same elementary functions as the inverse (detail::exp,
+ * detail::log), so under QUANT_ENABLE_CONSTEXPR the scalar calls fold at
+ * compile time too. Phi and Q always use detail::erfc_portable(), in both
+ * modes, so the scalar and batch values agree bit for bit. Phi and Q
+ * are each taken from erfc on the side where it keeps relative precision;
+ * log Phi uses the asymptotic series once Phi underflows and log1p(-Q) in
+ * the upper half, so it stays accurate in both tails. The batch Phi and Q
+ * file each block by erfc region and run the regions as separate
+ * vectorized loops over detail::erfc_small() and friends.
+ */
+
+#include "InverseCumulativeNormal.h"
+
+namespace quant {
+
+class CumulativeNormal {
+  public:
+    explicit constexpr CumulativeNormal(double average = 0.0, double sigma = 1.0)
+    : average_(average), sigma_(sigma) {}
+
+    // Phi((x - average) / sigma)
+    QUANT_CONSTEXPR double operator()(double x) const {
+        return standard_value((x - average_) / sigma_);
+    }
+
+    // 1 - Phi((x - average) / sigma) without cancellation
+    QUANT_CONSTEXPR double complement(double x) const {
+        return standard_complement((x - average_) / sigma_);
+    }
+
+    QUANT_CONSTEXPR double density(double x) const {
+        return standard_density((x - average_) / sigma_) / sigma_;
+    }
+
+    QUANT_CONSTEXPR double log_value(double x) const {
+        return standard_log_value((x - average_) / sigma_);
+    }
+
+    // Batch Phi and Q go through half_erfc(), which is bit-identical to the
+    // scalar calls but runs each erfc region as a vectorized loop
+    inline void operator()(const double* in, double* out, size_t n) const {
+        double x[BLOCK];
+        for (size_t b = 0; b < n; b += BLOCK) {
+            const size_t m = min(n - b, BLOCK);
+            for (size_t i = 0; i < m; ++i) {
+                x[i] = -((in[b + i] - average_) / sigma_) * INV_SQRT_2;
+            }
+            half_erfc(x, out + b, m);
+        }
+    }
+
+    inline void complement(const double* in, double* out, size_t n) const {
+        double x[BLOCK];
+        for (size_t b = 0; b < n; b += BLOCK) {
+            const size_t m = min(n - b, BLOCK);
+            for (size_t i = 0; i < m; ++i) {
+                x[i] = ((in[b + i] - average_) / sigma_) * INV_SQRT_2;
+            }
+            half_erfc(x, out + b, m);
+        }
+    }
+
+    inline void density(const double* in, double* out, size_t n) const {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = standard_density((in[i] - average_) / sigma_) / sigma_;
+        }
+    }
+
+    inline void log_value(const double* in, double* out, size_t n) const {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = standard_log_value((in[i] - average_) / sigma_);
+        }
+    }
+
+    static QUANT_CONSTEXPR double standard_value(double z) {
+        return 0.5 * detail::erfc_portable(-z * INV_SQRT_2);
+    }
+
+    static QUANT_CONSTEXPR double standard_complement(double z) {
+        return 0.5 * detail::erfc_portable(z * INV_SQRT_2);
+    }
+
+    static QUANT_CONSTEXPR double standard_density(double z) {
+        return INV_SQRT_2PI * detail::exp(-0.5 * z * z);
+    }
+
+    // Below LOG_PHI_ASYMPTOTIC, where erfc underflows, uses
+    // Phi(z) = phi(z)/|z| * (1 - 1/z^2 + 3/z^4 - 15/z^6 + ...)
+    static QUANT_CONSTEXPR double standard_log_value(double z) {
+        if (z != z) return z;
+        if (z > 0.0) return log1p(-standard_complement(z));
+        if (z > LOG_PHI_ASYMPTOTIC) return detail::log(standard_value(z));
+        if (z == -numeric_limits<double>::infinity()) return z;
+
+        const double w = 1.0 / (z * z);
+        double S = 1.0;
+        for (int k = LOG_PHI_TERMS; k >= 1; --k) {
+            S = 1.0 - (2 * k - 1) * w * S;
+        }
+
+        return -0.5 * z * z - detail::log(-z) - LOG_SQRT_2PI + detail::log(S);
+    }
+
+  private:
+    // out[i] = 0.5 erfc(x[i]) for m <= BLOCK inputs, bit-identical to the
+    // scalar erfc_portable(). Inputs are packed by erfc region without branching, into
+    // |x| < ERFC_NEAR_MAX and the two tail regions, with the list counters in
+    // registers; each list then runs as one straight-line loop that the
+    // compiler vectorizes. The rare inputs with NaN, |x| >= ERFC_NORMAL_MAX
+    // or erfc(x) = 2 take the scalar erfc_portable().
+    static inline void half_erfc(const double* x, double* out, size_t m) {
+        double body[BLOCK + 1], mid[BLOCK + 1], far[BLOCK + 1];
+        uint16_t body_index[BLOCK + 1], mid_index[BLOCK + 1], far_index[BLOCK + 1];
+        uint16_t other_index[BLOCK + 1];
+        size_t n_body = 0, n_mid = 0, n_far = 0, n_other = 0;
+        for (size_t i = 0; i < m; ++i) {
+            const double v = x[i];
+            const double a = detail::abs(v);
+            const bool other = !(a < detail::ERFC_NORMAL_MAX) || (v < 0.0 && a > detail::ERFC_TWO);
+            const bool is_tail = a >= detail::ERFC_NEAR_MAX;
+            const bool is_far = a >= detail::ERFC_MID_MAX;
+            body[n_body] = v;
+            body_index[n_body] = uint16_t(i);
+            mid[n_mid] = v;
+            mid_index[n_mid] = uint16_t(i);
+            far[n_far] = v;
+            far_index[n_far] = uint16_t(i);
+            other_index[n_other] = uint16_t(i);
+            n_body += !is_tail && !other;
+            n_mid += is_tail && !is_far && !other;
+            n_far += is_far && !other;
+            n_other += other;
+        }
+
+        for (size_t k = 0; k < n_body; ++k) {
+            const double a = detail::abs(body[k]);
+            const bool negative = body[k] < 0.0;
+            const double small = detail::erfc_small(a, negative);
+            const double near = detail::erfc_near(a, negative);
+            body[k] = 0.5 * (a < detail::ERFC_SMALL_MAX ? small : near);
+        }
+        for (size_t k = 0; k < n_mid; ++k) {
+            const double a = detail::abs(mid[k]);
+            mid[k] = 0.5 * detail::erfc_tail_normal(a, mid[k] < 0.0, detail::erfc_mid_ratio(a));
+        }
+        for (size_t k = 0; k < n_far; ++k) {
+            const double a = detail::abs(far[k]);
+            far[k] = 0.5 * detail::erfc_tail_normal(a, far[k] < 0.0, detail::erfc_far_ratio(a));
+        }
+
+        for (size_t k = 0; k < n_body; ++k) out[body_index[k]] = body[k];
+        for (size_t k = 0; k < n_mid; ++k) out[mid_index[k]] = mid[k];
+        for (size_t k = 0; k < n_far; ++k) out[far_index[k]] = far[k];
+        for (size_t k = 0; k < n_other; ++k) out[other_index[k]] = 0.5 * detail::erfc_portable(x[other_index[k]]);
+    }
+
+    // log(1 + x) for -0.5 <= x <= 0: with u = 1 + x rounded, the factor
+    // x / (u - 1) corrects log u for the rounding of u
+    static QUANT_CONSTEXPR double log1p(double x) {
+        const double u = 1.0 + x;
+        if (u == 1.0) return x;
+        return detail::log(u) * (x / (u - 1.0));
+    }
+
+    static constexpr double INV_SQRT_2 = 0.707106781186547524400844362104849039284835937688474036588;
+    static constexpr double INV_SQRT_2PI = 0.398942280401432677939946059934381868475858631164934657;
+    static constexpr double LOG_SQRT_2PI = 0.918938533204672741780329736405617639;
+    static constexpr double LOG_PHI_ASYMPTOTIC = -37.0;
+    static constexpr int LOG_PHI_TERMS = 8;
+    static constexpr size_t BLOCK = 256;
+
+    double average_;
+    double sigma_;
+};
+
+} // namespace quant
@@ -0,0 +1,178 @@
+#pragma once
+/*
+ * Gaussian copula sampler: correlated normals, Phi, optional marginals.
+ *
+ * Correlation comes from a factor model,
+ *
+ *   X_d = sum_k B_dk M_k + sqrt(1 - |B_d|^2) e_d,
+ *
+ * with k systematic factors M and one idiosyncratic normal e per dimension
+ * (a dense correlation matrix is the special case B = its Cholesky factor).
+ * Factor k draws from Philox substream k and dimension d from substream
+ * factors + d, one word per scenario, so any tile of scenarios x dimensions
+ * is reproducible on its own and the output does not depend on tiling or
+ * threading. Each tile is filled with normals, correlated, mapped through the
+ * batch Phi and, if given, through a marginal inverse CDF before it is handed
+ * on, so the full scenario matrix never exists in memory.
+ *
+ * Default thresholds Phi^{-1}(PD_d) are computed once with the batch probit;
+ * a scenario defaults obligor d when X_d < threshold_d, which can be tested on
+ * fill_normals() output without Phi.
+ */
+
+#include "CumulativeNormal.h"
+#include "InverseCumulativeNormal.h"
+#include "ParallelStreams.h"
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace quant {
+
+class GaussianCopula {
+  public:
+    // loadings is dims x n_factors, row-major. Throws std::invalid_argument
+    // if a row has |B_d| > 1, which leaves no variance for e_d.
+    GaussianCopula(const double* loadings, size_t dims, size_t n_factors, uint64_t seed)
+    : dims_(dims), n_factors_(n_factors), seed_(seed),
+      loadings_(loadings, loadings + dims * n_factors), idiosyncratic_(dims) {
+        for (size_t d = 0; d < dims_; ++d) {
+            double norm2 = 0.0;
+            for (size_t k = 0; k < n_factors_; ++k) {
+                norm2 += loadings_[d * n_factors_ + k] * loadings_[d * n_factors_ + k];
+            }
+            if (!(norm2 <= 1.0)) {
+                throw invalid_argument("GaussianCopula: loading norms must not exceed 1");
+            }
+            idiosyncratic_[d] = sqrt(1.0 - norm2);
+        }
+    }
+
+    // Full correlation matrix (dims x dims, row-major) through its Cholesky
+    // factor. Throws std::invalid_argument unless the diagonal is 1 and the
+    // matrix is positive definite (every pivot positive).
+    static GaussianCopula from_correlation(const double* correlation, size_t dims, uint64_t seed) {
+        vector<double> L(dims * dims, 0.0);
+        for (size_t j = 0; j < dims; ++j) {
+            if (correlation[j * dims + j] != 1.0) {
+                throw invalid_argument("GaussianCopula::from_correlation: diagonal must be 1");
+            }
+            double pivot = correlation[j * dims + j];
+            for (size_t k = 0; k < j; ++k) pivot -= L[j * dims + k] * L[j * dims + k];
+            if (!(pivot > 0.0)) {
+                throw invalid_argument("GaussianCopula::from_correlation: matrix is not positive definite");
+            }
+            const double l = sqrt(pivot);
+            L[j * dims + j] = l;
+            for (size_t i = j + 1; i < dims; ++i) {
+                double s = correlation[i * dims + j];
+                for (size_t k = 0; k < j; ++k) s -= L[i * dims + k] * L[j * dims + k];
+                L[i * dims + j] = s / l;
+            }
+        }
+        return GaussianCopula(L.data(), dims, dims, seed);
+    }
+
+    // Default thresholds out[d] = Phi^{-1}(pd[d]) by the batch probit
+    static inline void thresholds(const double* pd, double* out, size_t n) {
+        InverseCumulativeNormal()(pd, out, n);
+    }
+
+    size_t dims() const { return dims_; }
+    size_t factors() const { return n_factors_; }
+
+    // Correlated normals for scenarios [row_begin, row_end) x dimensions
+    // [col_begin, col_end), row-major with row length (col_end - col_begin)
+    void fill_normals(size_t row_begin, size_t row_end, size_t col_begin, size_t col_end, double* tile) const {
+        const size_t rows = row_end - row_begin;
+        const size_t cols = col_end - col_begin;
+
+        // Factor normals for the tile; one buffer per thread, reused across
+        // tiles and only grown when a larger tile arrives
+        thread_local vector<double> factors;
+        if (factors.size() < rows * n_factors_) factors.resize(rows * n_factors_);
+        for (size_t k = 0; k < n_factors_; ++k) {
+            Philox4x32 rng(seed_, k);
+            rng.discard(row_begin);
+            for (size_t r = 0; r < rows; ++r) {
+                factors[r * n_factors_ + k] = icn_.from_bits(rng());
+            }
+        }
+
+        for (size_t d = col_begin; d < col_end; ++d) {
+            Philox4x32 rng(seed_, n_factors_ + d);
+            rng.discard(row_begin);
+            const double* b = loadings_.data() + d * n_factors_;
+            double* column = tile + (d - col_begin);
+            for (size_t r = 0; r < rows; ++r) {
+                const double* m = factors.data() + r * n_factors_;
+                double systematic = 0.0;
+                for (size_t k = 0; k < n_factors_; ++k) {
+                    systematic = detail::fmadd(b[k], m[k], systematic);
+                }
+                column[r * cols] = detail::fmadd(idiosyncratic_[d], icn_.from_bits(rng()), systematic);
+            }
+        }
+    }
+
+    // Copula uniforms Phi(X) for the same tile
+    void fill(size_t row_begin, size_t row_end, size_t col_begin, size_t col_end, double* tile) const {
+        fill_normals(row_begin, row_end, col_begin, col_end, tile);
+        cdf_(tile, tile, (row_end - row_begin) * (col_end - col_begin));
+    }
+
+    // Uniforms passed through marginal(d, u), the inverse CDF of dimension d
+    template <class Marginal>
+    void fill(size_t row_begin, size_t row_end, size_t col_begin, size_t col_end, double* tile,
+              Marginal&& marginal) const {
+        fill(row_begin, row_end, col_begin, col_end, tile);
+        const size_t cols = col_end - col_begin;
+        for (size_t r = 0, rows = row_end - row_begin; r < rows; ++r) {
+            for (size_t c = 0; c < cols; ++c) {
+                tile[r * cols + c] = marginal(col_begin + c, tile[r * cols + c]);
+            }
+        }
+    }
+
+    // Whole scenarios [begin, end) into out[(end - begin) * dims], so the
+    // copula is a stream for generate_normals() and its thread pool
+    void fill(size_t begin, size_t end, double* out) const {
+        fill(begin, end, 0, dims_, out);
+    }
+
+    // Stream n_scenarios through consumer(row_begin, rows, col_begin, cols, tile)
+    // one column block at a time; only one tile is ever allocated
+    template <class Consumer>
+    void generate(size_t n_scenarios, Consumer&& consumer, size_t tile_rows = 4096, size_t tile_cols = 64) const {
+        generate_marginals(n_scenarios, [](size_t, double u) { return u; }, consumer, tile_rows, tile_cols);
+    }
+
+    template <class Marginal, class Consumer>
+    void generate_marginals(size_t n_scenarios, Marginal&& marginal, Consumer&& consumer,
+                            size_t tile_rows = 4096, size_t tile_cols = 64) const {
+        tile_rows = max<size_t>(1, tile_rows);
+        tile_cols = max<size_t>(1, tile_cols);
+        vector<double> tile(min(tile_rows, n_scenarios) * min(tile_cols, dims_));
+        for (size_t c0 = 0; c0 < dims_; c0 += tile_cols) {
+            const size_t c1 = min(dims_, c0 + tile_cols);
+            for (size_t r0 = 0; r0 < n_scenarios; r0 += tile_rows) {
+                const size_t r1 = min(n_scenarios, r0 + tile_rows);
+                fill(r0, r1, c0, c1, tile.data(), marginal);
+                consumer(r0, r1 - r0, c0, c1 - c0, static_cast<const double*>(tile.data()));
+            }
+        }
+    }
+
+  private:
+    size_t dims_;
+    size_t n_factors_;
+    uint64_t seed_;
+    vector<double> loadings_;        // B, dims x n_factors
+    vector<double> idiosyncratic_;   // sqrt(1 - |B_d|^2)
+    InverseCumulativeNormal icn_;
+    CumulativeNormal cdf_;
+};
+
+} // namespace quant
@@ -0,0 +1,239 @@
+#pragma once
+/*
+ * Inverse gamma and chi-square distributions (quantiles of Gamma(shape, scale)).
+ *
+ * The seed is the Wilson-Hilferty cube x = a (1 - 1/(9a) + z / (3 sqrt(a)))^3
+ * with z = Phi^{-1}(p) from InverseCumulativeNormal, so the batch takes its
+ * normals from the probit batch kernel. Small shapes use the leading terms of
+ * the tails instead where those are closer. Halley steps then solve
+ * log P(a, x) = log p below the median and log Q(a, x) = log q above it,
+ * both in log x: the equations are close to linear on the tails, and
+ * neither underflows. P comes from its power series and Q
+ * from Lentz's continued fraction, each on the side where it converges.
+ *
+ * For a >= STIRLING_SHAPE the prefactor x^a e^-x / Gamma(a) is taken as
+ * exp(a (log(1 + d) - d)) sqrt(a / 2 pi) exp(-stirlerr(a)), d = x/a - 1, so the
+ * large terms of a log x - x - lgamma(a) never cancel.
+ */
+
+#include "InverseCumulativeNormal.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace quant {
+
+class InverseCumulativeGamma {
+  public:
+    // Throws std::invalid_argument unless shape > 0, here and for every
+    // shape passed to quantiles_by_shape()
+    explicit InverseCumulativeGamma(double shape, double scale = 1.0)
+    : shape_(shape), scale_(scale), constants_(shape) {}
+
+    // Chi-square with dof degrees of freedom: Gamma(dof / 2, 2)
+    static InverseCumulativeGamma chi_square(double dof) {
+        return InverseCumulativeGamma(0.5 * dof, 2.0);
+    }
+
+    inline double operator()(double x) const {
+        return scale_ * standard_value(constants_, x, InverseCumulativeNormal::standard_value(x));
+    }
+
+    // Seeds for a block of inputs come from the probit batch kernel
+    inline void operator()(const double* in, double* out, size_t n) const {
+        double z[BLOCK];
+        for (size_t b = 0; b < n; b += BLOCK) {
+            const size_t m = min(n - b, BLOCK);
+            normal_(in + b, z, m);
+            for (size_t i = 0; i < m; ++i) {
+                out[b + i] = scale_ * standard_value(constants_, in[b + i], z[i]);
+            }
+        }
+    }
+
+    // Unit-scale quantiles with a shape per element: out[i] = Q(shape[i], x[i]).
+    // Per-shape constants are rebuilt only when the shape changes, so inputs
+    // grouped by shape pay for lgamma once per group.
+    static inline void quantiles_by_shape(const double* x, const double* shape, double* out, size_t n) {
+        const InverseCumulativeNormal normal;
+        double z[BLOCK];
+        ShapeConstants constants(n > 0 ? shape[0] : 1.0);
+        for (size_t b = 0; b < n; b += BLOCK) {
+            const size_t m = min(n - b, BLOCK);
+            normal(x + b, z, m);
+            for (size_t i = 0; i < m; ++i) {
+                if (shape[b + i] != constants.a) constants = ShapeConstants(shape[b + i]);
+                out[b + i] = standard_value(constants, x[b + i], z[i]);
+            }
+        }
+    }
+
+    double shape() const { return shape_; }
+    double scale() const { return scale_; }
+
+  private:
+    struct ShapeConstants {
+        explicit ShapeConstants(double shape)
+        : a(shape), log_gamma(lgamma(shape)), log_gamma_1(lgamma(shape + 1.0)),
+          stirling(shape >= STIRLING_SHAPE ? stirlerr(shape) : 0.0),
+          wh_shift(1.0 / (9.0 * shape)), wh_scale(1.0 / (3.0 * sqrt(shape))) {
+            if (!(shape > 0.0)) throw invalid_argument("InverseCumulativeGamma: shape must be positive");
+        }
+
+        double a;
+        double log_gamma;    // log Gamma(a)
+        double log_gamma_1;  // log Gamma(a + 1)
+        double stirling;     // lgamma(a) - Stirling's formula, large a only
+        double wh_shift;     // 1 / (9a)
+        double wh_scale;     // 1 / (3 sqrt(a))
+    };
+
+    // Standard (unit scale) quantile at probability x with z = Phi^{-1}(x)
+    static inline double standard_value(const ShapeConstants& k, double x, double z) {
+        if (x != x) return x;
+        if (x <= 0.0) return 0.0;
+        if (x >= 1.0) return numeric_limits<double>::infinity();
+
+        const double a = k.a;
+        const double c = 1.0 - k.wh_shift + z * k.wh_scale;
+        const double wilson_hilferty = c > 0.0 ? a * c * c * c : 0.0;
+
+        if (x <= 0.5) {
+            // P(a, x) < x^a / Gamma(a + 1), so the power law undershoots
+            const double log_p = log(x);
+            const double power_law = exp((log_p + k.log_gamma_1) / a);
+            double u = log(max(wilson_hilferty, power_law));
+            if (!(u > -numeric_limits<double>::infinity())) return 0.0;
+            for (int i = 0; i < MAX_HALLEY_STEPS; ++i) {
+                const double step = lower_step(k, u, log_p);
+                u -= step;
+                if (!(fabs(step) > HALLEY_TOLERANCE)) break;
+            }
+            return exp(u);
+        }
+
+        // Q(a, y) ~ y^(a-1) e^-y / Gamma(a) far out, solved once by
+        // substitution; for small shapes the power law in P still applies
+        const double q = 1.0 - x;
+        const double log_q = log(q);
+        double y = max(wilson_hilferty, exp((log(x) + k.log_gamma_1) / a));
+        const double t = -log_q - k.log_gamma;
+        if (t > 0.0) y = max(y, -log_q - k.log_gamma + (a - 1.0) * log(t));
+        double u = log(y);
+        if (!(u > -numeric_limits<double>::infinity())) return 0.0;
+        for (int i = 0; i < MAX_HALLEY_STEPS; ++i) {
+            const double step = upper_step(k, u, log_q);
+            u -= step;
+            if (!(fabs(step) > HALLEY_TOLERANCE)) break;
+        }
+        return exp(u);
+    }
+
+    // Halley step in u = log y on G(u) = log P(a, e^u) - log p, with
+    // G' = y f / P and G'' = G' (1 + y f'/f - G'), f'/f = (a - 1)/y - 1
+    static inline double lower_step(const ShapeConstants& k, double u, double log_p) {
+        const double y = exp(u);
+        const double log_pref = log_prefactor(k, y);
+        double log_P = 0.0;
+        if (y < k.a + 1.0) {
+            log_P = log_pref - log(k.a) + log(power_series(k.a, y));
+        } else {
+            log_P = log1p(-exp(log_pref) * continued_fraction(k.a, y));
+        }
+
+        const double G = log_P - log_p;
+        const double G1 = exp(log_pref - log_P);
+        const double G2 = G1 * (1.0 + (k.a - 1.0 - y) - G1);
+        return (G / G1) / (1.0 - 0.5 * G * G2 / (G1 * G1));
+    }
+
+    // Halley step in u = log y on g(u) = log Q(a, e^u) - log q, with
+    // g' = -H, H = y f / Q, and g'' = -H (1 + y f'/f + H)
+    static inline double upper_step(const ShapeConstants& k, double u, double log_q) {
+        const double y = exp(u);
+        const double log_pref = log_prefactor(k, y);
+        double log_Q = 0.0;
+        if (y >= k.a + 1.0) {
+            log_Q = log_pref + log(continued_fraction(k.a, y));
+        } else {
+            log_Q = log1p(-exp(log_pref - log(k.a)) * power_series(k.a, y));
+        }
+
+        const double g = log_Q - log_q;
+        const double H = exp(log_pref - log_Q);
+        return (-g / H) / (1.0 + 0.5 * g * (k.a - y + H) / H);
+    }
+
+    // log(y^a e^-y / Gamma(a))
+    static inline double log_prefactor(const ShapeConstants& k, double y) {
+        if (k.a < STIRLING_SHAPE) return k.a * log(y) - y - k.log_gamma;
+        constexpr double LOG_SQRT_2PI = 0.918938533204672741780329736405617639;
+        const double r = y / k.a;
+        const double d = r - 1.0;
+        const double core = fabs(d) > 0.125 ? log(r) - d : log1pmx(d);
+        return k.a * core + 0.5 * log(k.a) - LOG_SQRT_2PI - k.stirling;
+    }
+
+    // sum_n y^n / ((a + 1) ... (a + n)), so that P(a, y) = prefactor / a * sum
+    static inline double power_series(double a, double y) {
+        double term = 1.0, sum = 1.0;
+        for (int n = 1; n <= MAX_SERIES_TERMS; ++n) {
+            term *= y / (a + n);
+            sum += term;
+            if (term < sum * SERIES_TOLERANCE) break;
+        }
+        return sum;
+    }
+
+    // Continued fraction with Q(a, y) = prefactor * fraction (modified Lentz)
+    static inline double continued_fraction(double a, double y) {
+        constexpr double TINY = 1e-300;
+        double b = y + 1.0 - a;
+        double c = 1.0 / TINY;
+        double d = 1.0 / b;
+        double h = d;
+        for (int i = 1; i <= MAX_SERIES_TERMS; ++i) {
+            const double an = -i * (i - a);
+            b += 2.0;
+            d = an * d + b;
+            if (fabs(d) < TINY) d = TINY;
+            c = b + an / c;
+            if (fabs(c) < TINY) c = TINY;
+            d = 1.0 / d;
+            const double delta = d * c;
+            h *= delta;
+            if (fabs(delta - 1.0) < SERIES_TOLERANCE) break;
+        }
+        return h;
+    }
+
+    // log1p(d) - d for |d| <= 1/8, by its series
+    static inline double log1pmx(double d) {
+        double s = 0.0;
+        for (int k = 24; k >= 2; --k) {
+            s = ((k % 2) ? 1.0 : -1.0) / k + d * s;
+        }
+        return d * d * s;
+    }
+
+    // lgamma(a) - ((a - 1/2) log a - a + log sqrt(2 pi)) for a >= STIRLING_SHAPE
+    static inline double stirlerr(double a) {
+        const double v = 1.0 / (a * a);
+        return (1.0 / 12 - v * (1.0 / 360 - v * (1.0 / 1260 - v * (1.0 / 1680
+               - v * (1.0 / 1188 - v * (691.0 / 360360 - v * (1.0 / 156))))))) / a;
+    }
+
+    static constexpr size_t BLOCK = 256;
+    static constexpr double STIRLING_SHAPE = 10.0;
+    static constexpr int MAX_HALLEY_STEPS = 12;
+    static constexpr double HALLEY_TOLERANCE = 1e-7;
+    static constexpr int MAX_SERIES_TERMS = 100000;
+    static constexpr double SERIES_TOLERANCE = 1e-16;
+
+    double shape_;
+    double scale_;
+    ShapeConstants constants_;
+    InverseCumulativeNormal normal_;
+};
+
+} // namespace quant
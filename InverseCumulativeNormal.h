@@ -1,15 +1,26 @@
 #pragma once
 /*
  * Auto-generated from JSON coefficients
- * Generated: 2025-11-09T13:19:40.842903
+ * Generated: 2026-10-16T18:51:20.090403
  * 
  * Central region: degree (6, 6)
- *   Max error: 1.391751e-05
- *   Mean error: 1.212946e-06
+ *   Max error: 1.391108e-05
+ *   Mean error: 1.212255e-06
  * 
  * Tail region: degree (8, 8)
- *   Max error: 5.577336e-06
- *   Mean error: 1.435348e-06
+ *   Max error: 2.958431e-06
+ *   Mean error: 1.003287e-06
+ * 
+ * Segmented region: 63 octaves x 8 cells, degree 10
+ *   Max error: 2.173246e-16
+ *   Mean error: 5.304171e-17
+ * 
+ * Constant evaluation is opt-in: define QUANT_ENABLE_CONSTEXPR before the
+ * include to make the scalar quantiles constexpr. That mode replaces the
+ * <cmath> calls with the portable functions in detail, needs GCC 11+ or
+ * Clang 9+ (__builtin_bit_cast), and is bit-identical between compile time
+ * and run time only with -ffp-contract=off. Without it the header is plain
+ * C++17 and the runtime path uses <cmath>.
  * 
  * DO NOT EDIT THIS FILE MANUALLY
  * Regenerate using: python3 export_coefficients.py && python3 json_to_header.py
@@ -17,19 +28,635 @@
 
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <algorithm>
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+// Specifier for every function a constant-evaluated quantile can reach
+#if defined(QUANT_ENABLE_CONSTEXPR)
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 11
+#error "QUANT_ENABLE_CONSTEXPR needs __builtin_bit_cast (GCC 11+, Clang 9+)"
+#endif
+#define QUANT_CONSTEXPR constexpr
+#else
+#define QUANT_CONSTEXPR inline
+#endif
 
 using namespace std;
 
 namespace quant {
 
+// Portable elementary functions (*_portable): table lookups and multiply-adds
+// only, so they can be evaluated at compile time and give the same bits on
+// every target that does not contract multiply-adds on its own. All are
+// accurate to within a few ulp; erfc follows fdlibm. The quantile code calls
+// the dispatchers exp, expm1, log, erfc and sqrt at the end of the namespace,
+// which pick these under QUANT_ENABLE_CONSTEXPR and <cmath> otherwise.
+namespace detail {
+
+inline constexpr double LN2 = 0.693147180559945309417232121458176568;
+inline constexpr double LN2_HI = 6.93147180369123816490e-01;   // 32 bits, e * LN2_HI exact
+inline constexpr double LN2_LO = 1.90821492927058770002e-10;
+inline constexpr double EXP_OVERFLOW = 7.09782712893383973096e+02;
+inline constexpr double EXP_UNDERFLOW = -7.45133219101941108420e+02;
+inline constexpr double EXP_NORMAL_MIN = -707.0;   // exp() of anything above is normal
+
+// exp_split(): 2^(j/128), ln2 / 128 in two parts (the high part has 32 bits,
+// so n * EXP_STEP_HI is exact), and 1, 1/2!, ..., 1/5! for (exp(r) - 1) / r
+inline constexpr int EXP_TABLE_BITS = 7;
+inline constexpr int EXP_TABLE_SIZE = 1 << EXP_TABLE_BITS;
+inline constexpr double EXP_INV_STEP = 184.6649652337873;
+inline constexpr double EXP_STEP_HI = 0.005415212348452769;
+inline constexpr double EXP_STEP_LO = -3.2819649005320973e-13;
+inline constexpr double EXP_TABLE[EXP_TABLE_SIZE] = {
+    1.000000000000000000e+00,
+    1.005429901112802726e+00,
+    1.010889286051700475e+00,
+    1.016378314910953096e+00,
+    1.021897148654116627e+00,
+    1.027445949118763746e+00,
+    1.033024879021228415e+00,
+    1.038634101961378731e+00,
+    1.044273782427413755e+00,
+    1.049944085800687210e+00,
+    1.055645178360557157e+00,
+    1.061377227289262093e+00,
+    1.067140400676823697e+00,
+    1.072934867525975555e+00,
+    1.078760797757119860e+00,
+    1.084618362213309206e+00,
+    1.090507732665257690e+00,
+    1.096429081816376883e+00,
+    1.102382583307840891e+00,
+    1.108368411723678726e+00,
+    1.114386742595892432e+00,
+    1.120437752409606746e+00,
+    1.126521618608241848e+00,
+    1.132638519598719196e+00,
+    1.138788634756691565e+00,
+    1.144972144431804173e+00,
+    1.151189229952982673e+00,
+    1.157440073633751121e+00,
+    1.163724858777577476e+00,
+    1.170043769683250190e+00,
+    1.176396991650281221e+00,
+    1.182784710984341014e+00,
+    1.189207115002721027e+00,
+    1.195664392039827328e+00,
+    1.202156731452703076e+00,
+    1.208684323626581625e+00,
+    1.215247359980468955e+00,
+    1.221846032972757623e+00,
+    1.228480536106870025e+00,
+    1.235151063936933413e+00,
+    1.241857812073484002e+00,
+    1.248600977189204819e+00,
+    1.255380757024691096e+00,
+    1.262197350394250739e+00,
+    1.269050957191733220e+00,
+    1.275941778396392001e+00,
+    1.282870016078778264e+00,
+    1.289835873406665723e+00,
+    1.296839554651009641e+00,
+    1.303881265191935812e+00,
+    1.310961211524764414e+00,
+    1.318079601266064049e+00,
+    1.325236643159741323e+00,
+    1.332432547083161500e+00,
+    1.339667524053302916e+00,
+    1.346941786232945804e+00,
+    1.354255546936892651e+00,
+    1.361609020638224754e+00,
+    1.369002422974590516e+00,
+    1.376435970754530169e+00,
+    1.383909881963832023e+00,
+    1.391424375771926236e+00,
+    1.398979672538311236e+00,
+    1.406575993819015435e+00,
+    1.414213562373095145e+00,
+    1.421892602169165576e+00,
+    1.429613338391970023e+00,
+    1.437375997448982368e+00,
+    1.445180806977046650e+00,
+    1.453027995849052623e+00,
+    1.460917794180647045e+00,
+    1.468850433336981842e+00,
+    1.476826145939499346e+00,
+    1.484845165872752393e+00,
+    1.492907728291264835e+00,
+    1.501014069626425584e+00,
+    1.509164427593422841e+00,
+    1.517359041198214742e+00,
+    1.525598150744538417e+00,
+    1.533881997840955913e+00,
+    1.542210825407940744e+00,
+    1.550584877684999974e+00,
+    1.559004400237836929e+00,
+    1.567469639965552997e+00,
+    1.575980845107886497e+00,
+    1.584538265252493749e+00,
+    1.593142151342266999e+00,
+    1.601792755682693414e+00,
+    1.610490331949254283e+00,
+    1.619235135194863728e+00,
+    1.628027421857347834e+00,
+    1.636867449766964411e+00,
+    1.645755478153964946e+00,
+    1.654691767656194301e+00,
+    1.663676580326736376e+00,
+    1.672710179641596628e+00,
+    1.681792830507429004e+00,
+    1.690924799269305279e+00,
+    1.700106353718523478e+00,
+    1.709337763100462926e+00,
+    1.718619298122477934e+00,
+    1.727951230961837670e+00,
+    1.737333835273706217e+00,
+    1.746767386199169048e+00,
+    1.756252160373299454e+00,
+    1.765788435933272726e+00,
+    1.775376492526521188e+00,
+    1.785016611318934965e+00,
+    1.794709075003107168e+00,
+    1.804454167806623932e+00,
+    1.814252175500398856e+00,
+    1.824103385407053413e+00,
+    1.834008086409342431e+00,
+    1.843966568958625984e+00,
+    1.853979125083385471e+00,
+    1.864046048397788979e+00,
+    1.874167634110299963e+00,
+    1.884344179032334532e+00,
+    1.894575981586965607e+00,
+    1.904863341817674138e+00,
+    1.915206561397147400e+00,
+    1.925605943636125028e+00,
+    1.936061793492294347e+00,
+    1.946574417579233218e+00,
+    1.957144124175400179e+00,
+    1.967771223233175881e+00,
+    1.978456026387950928e+00,
+    1.989198846967266343e+00
+};
+inline constexpr int EXP_DEGREE = 5;
+inline constexpr double EXP_TAYLOR[EXP_DEGREE] = {
+    1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120
+};
+
+// log_core(): {1/c, log c} per cell, and log1p(r) / r = 1 - r/2 + r^2/3 - ...
+inline constexpr int LOG_TABLE_BITS = 7;
+inline constexpr uint64_t LOG_OFFSET = 0x3fe6000000000000;
+inline constexpr double LOG_TABLE[256] = {
+    1.450424929149448872e+00, -3.718565680862021550e-01,
+    1.442253521177917719e+00, -3.662068355995622970e-01,
+    1.434173669666051865e+00, -3.605888433981119245e-01,
+    1.426183843985199928e+00, -3.550022365330390284e-01,
+    1.418282548431307077e+00, -3.494466666747945705e-01,
+    1.410468319430947304e+00, -3.439217906837075400e-01,
+    1.402739726006984711e+00, -3.384272714424643724e-01,
+    1.395095367915928364e+00, -3.329627770340502502e-01,
+    1.387533875182271004e+00, -3.275279808862032738e-01,
+    1.380053908564150333e+00, -3.221225625830487771e-01,
+    1.372654155362397432e+00, -3.167462052983763265e-01,
+    1.365333333145827055e+00, -3.113985989317632486e-01,
+    1.358090185560286045e+00, -3.060794375060045258e-01,
+    1.350923482794314623e+00, -3.007884199161541816e-01,
+    1.343832021113485098e+00, -2.955252499992088167e-01,
+    1.336814621463418007e+00, -2.902896358988795722e-01,
+    1.329870129935443401e+00, -2.850812908008362734e-01,
+    1.322997415903955698e+00, -2.798999319215049741e-01,
+    1.316195372957736254e+00, -2.747452815784040547e-01,
+    1.309462915640324354e+00, -2.696170650841553385e-01,
+    1.302798982243984938e+00, -2.645150132129928111e-01,
+    1.296202531550079584e+00, -2.594388600647168364e-01,
+    1.289672544226050377e+00, -2.543883444650947290e-01,
+    1.283208020031452179e+00, -2.493632081350924123e-01,
+    1.276807980146259069e+00, -2.443631978084266632e-01,
+    1.270471463911235332e+00, -2.393880630073323135e-01,
+    1.264197530690580606e+00, -2.344375577956349377e-01,
+    1.257985258009284735e+00, -2.295114396160121972e-01,
+    1.251833740621805191e+00, -2.246094688293590047e-01,
+    1.245742092374712229e+00, -2.197314104768800513e-01,
+    1.239709442947059870e+00, -2.148770319556932429e-01,
+    1.233734939713031054e+00, -2.100461047715201923e-01,
+    1.227817745879292488e+00, -2.052384033025519694e-01,
+    1.221957040484994650e+00, -2.004537050455199587e-01,
+    1.216152018867433071e+00, -1.956917912461680065e-01,
+    1.210401891265064478e+00, -1.909524460032342441e-01,
+    1.204705882351845503e+00, -1.862354561141814635e-01,
+    1.199063231702893972e+00, -1.815406116881014553e-01,
+    1.193473193328827620e+00, -1.768677059905280069e-01,
+    1.187935034744441509e+00, -1.722165348866472878e-01,
+    1.182448036968708038e+00, -1.675868970515698442e-01,
+    1.177011494059115648e+00, -1.629785937862051615e-01,
+    1.171624714042991400e+00, -1.583914300157677202e-01,
+    1.166287016123533249e+00, -1.538252121171315434e-01,
+    1.160997732542455196e+00, -1.492797496927062151e-01,
+    1.155756207648664713e+00, -1.447548549716347888e-01,
+    1.150561797898262739e+00, -1.402503429996873330e-01,
+    1.145413870457559824e+00, -1.357660306105663850e-01,
+    1.140311804134398699e+00, -1.313017374073023602e-01,
+    1.135254988912492990e+00, -1.268572855359199336e-01,
+    1.130242825485765934e+00, -1.224324994491533952e-01,
+    1.125274725258350372e+00, -1.180272060740054502e-01,
+    1.120350109413266182e+00, -1.136412341489410616e-01,
+    1.115468409378081560e+00, -1.092744147925162196e-01,
+    1.110629067290574312e+00, -1.049265820837865237e-01,
+    1.105831533670425415e+00, -1.005975711278966900e-01,
+    1.101075268816202879e+00, -9.628721945124198156e-02,
+    1.096359743271023035e+00, -9.199536758070374354e-02,
+    1.091684435028582811e+00, -8.772185664870760236e-02,
+    1.087048832327127457e+00, -8.346653107402174365e-02,
+    1.082452431321144104e+00, -7.922923657667864383e-02,
+    1.077894737012684345e+00, -7.500982116311864789e-02,
+    1.073375261854380369e+00, -7.080813396472016019e-02,
+    1.068893528077751398e+00, -6.662402752945763285e-02,
+    1.064449064433574677e+00, -6.245735491919469223e-02,
+    1.060041408054530621e+00, -5.830797156337706733e-02,
+    1.055670103058218956e+00, -5.417573406928277713e-02,
+    1.051334702409803867e+00, -5.006050210061815942e-02,
+    1.047034764662384987e+00, -4.596213540820266730e-02,
+    1.042769857216626406e+00, -4.188049703671292007e-02,
+    1.038539553526788950e+00, -3.781545077944844374e-02,
+    1.034343434497714043e+00, -3.376686261997461497e-02,
+    1.030181086622178555e+00, -2.973459904292347425e-02,
+    1.026052104309201241e+00, -2.571852938621454684e-02,
+    1.021956088021397591e+00, -2.171852414745586296e-02,
+    1.017892644274979830e+00, -1.773445507710227909e-02,
+    1.013861386105418205e+00, -1.376619573140614936e-02,
+    1.009861933067440987e+00, -9.813621575653880269e-03,
+    1.005893909838050604e+00, -5.876608699078317982e-03,
+    1.000000000000000000e+00, -0.000000000000000000e+00,
+    1.000000000000000000e+00, -0.000000000000000000e+00,
+    9.884169884026050568e-01, 1.165061723452718960e-02,
+    9.808429118711501360e-01, 1.934296284949739778e-02,
+    9.733840303961187601e-01, 2.697658772093944335e-02,
+    9.660377358086407185e-01, 3.455238154849649135e-02,
+    9.588014981709420681e-01, 4.207121387521232242e-02,
+    9.516728625167161226e-01, 4.953393505588351425e-02,
+    9.446494465228170156e-01, 5.694137637012509912e-02,
+    9.377289377152919769e-01, 6.429435071994916984e-02,
+    9.309090909082442522e-01, 7.159365318791831301e-02,
+    9.241877256426960230e-01, 7.884006169595259017e-02,
+    9.175627240911126137e-01, 8.603433725812964505e-02,
+    9.110320284962654114e-01, 9.317722482507946602e-02,
+    9.045936395414173603e-01, 1.002694532018739287e-01,
+    8.982456140220165253e-01, 1.073117358036399654e-01,
+    8.919860627502202988e-01, 1.143047712436788405e-01,
+    8.858131486922502518e-01, 1.212492437420090441e-01,
+    8.797250858042389154e-01, 1.281458228128928289e-01,
+    8.737201364710927010e-01, 1.349951645920745014e-01,
+    8.677966101095080376e-01, 1.417979119293789336e-01,
+    8.619528620038181543e-01, 1.485546942640199874e-01,
+    8.561872909776866436e-01, 1.552661289020290103e-01,
+    8.504983389284461737e-01, 1.619328202011011408e-01,
+    8.448844884987920523e-01, 1.685553609706895162e-01,
+    8.393442623782902956e-01, 1.751343320287142291e-01,
+    8.338762214407324791e-01, 1.816703031767562815e-01,
+    8.284789645113050938e-01, 1.881638322853967649e-01,
+    8.231511253397911787e-01, 1.946154677751597284e-01,
+    8.178913737647235394e-01, 2.010257461060654671e-01,
+    8.126984126865863800e-01, 2.073951943606225090e-01,
+    8.075709778349846601e-01, 2.137243295004910282e-01,
+    8.025078370701521635e-01, 2.200136582061471835e-01,
+    7.975077880546450615e-01, 2.262636787850585973e-01,
+    7.925696594174951315e-01, 2.324748787749263690e-01,
+    7.876923077274113894e-01, 2.386477378056097720e-01,
+    7.828746177256107330e-01, 2.447827264322428309e-01,
+    7.781155016273260117e-01, 2.508803061475662344e-01,
+    7.734138972591608763e-01, 2.569409309256947549e-01,
+    7.687687687575817108e-01, 2.629650455154332600e-01,
+    7.641791044734418392e-01, 2.689530873509609066e-01,
+    7.596439169719815254e-01, 2.749054857964016718e-01,
+    7.551622418686747551e-01, 2.808226629263536611e-01,
+    7.507331378292292356e-01, 2.867050328048638130e-01,
+    7.463556851726025343e-01, 2.925530026308982845e-01,
+    7.420289854053407907e-01, 2.983669726891309826e-01,
+    7.377521614544093609e-01, 3.041473353708902816e-01,
+    7.335243553388863802e-01, 3.098944776710235161e-01,
+    7.293447293341159821e-01, 3.156087790008552663e-01
+};
+inline constexpr int LOG1P_DEGREE = 7;
+inline constexpr double LOG1P[LOG1P_DEGREE + 1] = {
+    1.0, -1.0 / 2, 1.0 / 3, -1.0 / 4, 1.0 / 5, -1.0 / 6, 1.0 / 7, -1.0 / 8
+};
+
+QUANT_CONSTEXPR uint64_t bits_of(double x) {
+#if defined(QUANT_ENABLE_CONSTEXPR)
+    return __builtin_bit_cast(uint64_t, x);
+#else
+    uint64_t bits = 0;
+    memcpy(&bits, &x, sizeof bits);
+    return bits;
+#endif
+}
+
+QUANT_CONSTEXPR double from_bits(uint64_t bits) {
+#if defined(QUANT_ENABLE_CONSTEXPR)
+    return __builtin_bit_cast(double, bits);
+#else
+    double x = 0.0;
+    memcpy(&x, &bits, sizeof x);
+    return x;
+#endif
+}
+
+// 2^k for -1022 <= k <= 1023
+QUANT_CONSTEXPR double pow2(int k) {
+    return from_bits(uint64_t(k + 1023) << 52);
+}
+
+// The compare-and-negate folds at compile time; at run time fabs is a
+// single mask, where the compare costs the central path ~10%
+QUANT_CONSTEXPR double abs(double x) {
+#if defined(QUANT_ENABLE_CONSTEXPR)
+    if (__builtin_is_constant_evaluated()) return x < 0.0 ? -x : x;
+#endif
+    return std::fabs(x);
+}
+
+// a * b + c, fused when the target has FMA. GCC folds __builtin_fma exactly
+// in constant expressions, so both forms agree between compile and run time.
+QUANT_CONSTEXPR double fmadd(double a, double b, double c) {
+#if defined(__FMA__) && defined(__GNUC__) && !defined(__clang__)
+    return __builtin_fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+// c[0] + x (c[1] + x (c[2] + ...)), n coefficients
+QUANT_CONSTEXPR double horner(const double* c, int n, double x) {
+    double p = c[n - 1];
+    for (int i = n - 2; i >= 0; --i) {
+        p = fmadd(p, x, c[i]);
+    }
+    return p;
+}
+
+// Correctly rounded square root of a positive normal x: the 53-bit root of
+// the mantissa scaled to 104-106 bits, digit by digit, rounded to nearest
+QUANT_CONSTEXPR double sqrt_exact(double x) {
+    const uint64_t bits = bits_of(x);
+    const int q = int(bits >> 52) - 1075;
+    const uint64_t M = (bits & ((uint64_t(1) << 52) - 1)) | (uint64_t(1) << 52);
+    const int s = ((q - 52) & 1) ? 53 : 52;
+
+    uint64_t root = 0, rem = 0;
+    for (int pair = 52; pair >= 0; --pair) {
+        const int lo = 2 * pair - s;
+        uint64_t next = 0;
+        if (lo + 1 >= 0 && lo + 1 < 53) next |= ((M >> (lo + 1)) & 1) << 1;
+        if (lo >= 0 && lo < 53) next |= (M >> lo) & 1;
+        rem = (rem << 2) | next;
+        const uint64_t trial = (root << 2) | 1;
+        if (rem >= trial) {
+            rem -= trial;
+            root = (root << 1) | 1;
+        } else {
+            root <<= 1;
+        }
+    }
+    if (rem > root) ++root;
+
+    return double(root) * pow2((q - s) / 2);
+}
+
+// Hardware at run time, sqrt_exact() in constant expressions: both are
+// correctly rounded, so they agree
+QUANT_CONSTEXPR double sqrt_portable(double x) {
+#if defined(QUANT_ENABLE_CONSTEXPR)
+    if (!__builtin_is_constant_evaluated()) return std::sqrt(x);
+#else
+    return std::sqrt(x);
+#endif
+    if (x != x || x < 0.0) return numeric_limits<double>::quiet_NaN();
+    if (x == 0.0 || x == numeric_limits<double>::infinity()) return x;
+    if (x < numeric_limits<double>::min()) return sqrt_exact(x * 0x1p54) * 0x1p-27;
+    return sqrt_exact(x);
+}
+
+// y * 2^k for y in [0.5, 2] and the k range reached by exp()
+QUANT_CONSTEXPR double scale(double y, int k) {
+    if (k > 1023) return y * pow2(1023) * pow2(k - 1023);
+    if (k < -1021) return y * pow2(k + 54) * 0x1p-54;
+    return y * pow2(k);
+}
+
+// 2^(j/128) exp(r) for x + x_lo reduced at n = 128 k + j
+QUANT_CONSTEXPR double exp_reduced(double x, double x_lo, int n) {
+    const double r = (x - double(n) * EXP_STEP_HI) - double(n) * EXP_STEP_LO + x_lo;
+    const double P = horner(EXP_TAYLOR, EXP_DEGREE, r);
+    const double t = EXP_TABLE[n & (EXP_TABLE_SIZE - 1)];
+    return fmadd(t, r * P, t);
+}
+
+// exp(x + x_lo) for an argument carried in two parts: x + x_lo =
+// (128 k + j) ln2 / 128 + r with |r| <= ln2 / 256, and exp = 2^k 2^(j/128) exp(r)
+// with 2^(j/128) tabulated and a degree-5 Taylor polynomial for exp(r) - 1
+QUANT_CONSTEXPR double exp_split(double x, double x_lo) {
+    const double sum = x + x_lo;
+    if (sum != sum) return sum;
+    if (sum > EXP_OVERFLOW) return numeric_limits<double>::infinity();
+    if (sum < EXP_UNDERFLOW) return 0.0;
+
+    const int n = int(sum * EXP_INV_STEP + (sum < 0.0 ? -0.5 : 0.5));
+    return scale(exp_reduced(x, x_lo, n), n >> EXP_TABLE_BITS);
+}
+
+// exp_split() for EXP_NORMAL_MIN <= x + x_lo <= 0, where the result is a
+// normal double: no range checks, so loops over it vectorize, and the same
+// operations as exp_split(), so the result is bit-identical
+QUANT_CONSTEXPR double exp_split_normal(double x, double x_lo) {
+    const int n = int((x + x_lo) * EXP_INV_STEP - 0.5);
+    return exp_reduced(x, x_lo, n) * pow2(n >> EXP_TABLE_BITS);
+}
+
+QUANT_CONSTEXPR double exp_portable(double x) {
+    return exp_split(x, 0.0);
+}
+
+// exp(x) - 1: Taylor series for |x| < ln2 / 2, exp(x) - 1 beyond
+QUANT_CONSTEXPR double expm1_portable(double x) {
+    constexpr int DEGREE = 14;
+    constexpr double TAYLOR[DEGREE] = {
+        1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720, 1.0 / 5040,
+        1.0 / 40320, 1.0 / 362880, 1.0 / 3628800, 1.0 / 39916800,
+        1.0 / 479001600, 1.0 / 6227020800, 1.0 / 87178291200
+    };
+
+    if (abs(x) < 0.5 * LN2) {
+        double P = TAYLOR[DEGREE - 1];
+        for (int i = DEGREE - 2; i >= 0; --i) {
+            P = fmadd(P, x, TAYLOR[i]);
+        }
+        return x * P;
+    }
+    return exp_portable(x) - 1.0;
+}
+
+// log y for positive normal finite y: y = 2^e f with f in [0.6875, 1.375)
+// from the IEEE fields; LOG_TABLE_BITS bits past LOG_OFFSET pick a cell with
+// tabulated 1/c and log c, and log f = log c + log1p(f / c - 1) with
+// |f / c - 1| <= 2^-7. The two cells next to 1 use c = 1, so log y keeps its
+// relative precision as y -> 1. Table lookup and multiply-adds only.
+// e ln 2 is split so that e LN2_HI + log c carries the only large rounding;
+// e_bias is added to the exponent (log of a prescaled subnormal).
+QUANT_CONSTEXPR double log_core(double y, int e_bias = 0) {
+    const uint64_t bits = bits_of(y);
+    const uint64_t shifted = bits - LOG_OFFSET;
+    const int e = int(int64_t(shifted) >> 52) + e_bias;
+    const size_t i = size_t(shifted >> (52 - LOG_TABLE_BITS)) & ((size_t(1) << LOG_TABLE_BITS) - 1);
+    const double f = from_bits(bits - (shifted & (uint64_t(0xFFF) << 52)));
+
+    // 1/c has 32 significant bits, so with f split at 21 bits the first
+    // product is exact and r carries a single rounding
+    const double f_hi = from_bits(bits_of(f) & 0xFFFFFFFF00000000ull);
+    const double r = (f_hi * LOG_TABLE[2 * i] - 1.0) + (f - f_hi) * LOG_TABLE[2 * i];
+    const double P = horner(LOG1P, LOG1P_DEGREE + 1, r);
+
+    const double hi = fmadd(double(e), LN2_HI, LOG_TABLE[2 * i + 1]);
+    return hi + fmadd(r, P, double(e) * LN2_LO);
+}
+
+QUANT_CONSTEXPR double log_portable(double x) {
+    if (x != x || x < 0.0) return numeric_limits<double>::quiet_NaN();
+    if (x == 0.0) return -numeric_limits<double>::infinity();
+    if (x == numeric_limits<double>::infinity()) return x;
+    if (x < numeric_limits<double>::min()) return log_core(x * 0x1p54, -54);
+    return log_core(x);
+}
+
+// fdlibm erfc coefficients and region bounds in |x|
+inline constexpr double ERFC_ERX = 8.45062911510467529297e-01;
+inline constexpr double ERFC_PP[5] = {
+    1.28379167095512558561e-01, -3.25042107247001499370e-01, -2.84817495755985104766e-02,
+    -5.77027029648944159157e-03, -2.37630166566501626084e-05
+};
+inline constexpr double ERFC_QQ[6] = {
+    1.0, 3.97917223959155352819e-01, 6.50222499887672944485e-02,
+    5.08130628187576562776e-03, 1.32494738004321644526e-04, -3.96022827877536812320e-06
+};
+inline constexpr double ERFC_PA[7] = {
+    -2.36211856075265944077e-03, 4.14856118683748331666e-01, -3.72207876035701323847e-01,
+    3.18346619901161753674e-01, -1.10894694282396677476e-01, 3.54783043256182359371e-02,
+    -2.16637559486879084300e-03
+};
+inline constexpr double ERFC_QA[7] = {
+    1.0, 1.06420880400844228286e-01, 5.40397917702171048937e-01, 7.18286544141962662868e-02,
+    1.26171219808761642112e-01, 1.36370839120290507362e-02, 1.19844998467991074170e-02
+};
+inline constexpr double ERFC_RA[8] = {
+    -9.86494403484714822705e-03, -6.93858572707181764372e-01, -1.05586262253232909814e+01,
+    -6.23753324503260060396e+01, -1.62396669462573470355e+02, -1.84605092906711035994e+02,
+    -8.12874355063065934246e+01, -9.81432934416914548592e+00
+};
+inline constexpr double ERFC_SA[9] = {
+    1.0, 1.96512716674392571292e+01, 1.37657754143519042600e+02, 4.34565877475229228821e+02,
+    6.45387271733267880336e+02, 4.29008140027567833386e+02, 1.08635005541779435134e+02,
+    6.57024977031928170135e+00, -6.04244152148580987438e-02
+};
+inline constexpr double ERFC_RB[7] = {
+    -9.86494292470009928597e-03, -7.99283237680523006574e-01, -1.77579549177547519889e+01,
+    -1.60636384855821916062e+02, -6.37566443368389627722e+02, -1.02509513161107724954e+03,
+    -4.83519191608651397019e+02
+};
+inline constexpr double ERFC_SB[8] = {
+    1.0, 3.03380607434824582924e+01, 3.25792512996573918826e+02, 1.53672958608443695994e+03,
+    3.19985821950859553908e+03, 2.55305040643316442583e+03, 4.74528541206955367215e+02,
+    -2.24409524465858183362e+01
+};
+inline constexpr double ERFC_SMALL_MAX = 0.84375;
+inline constexpr double ERFC_NEAR_MAX = 1.25;
+inline constexpr double ERFC_MID_MAX = 1.0 / 0.35;
+inline constexpr double ERFC_NORMAL_MAX = 26.0;    // exp(-a^2) still normal
+inline constexpr double ERFC_ZERO = 28.0;          // erfc(a) underflows
+inline constexpr double ERFC_TWO = 6.0;            // erfc(-a) rounds to 2
+
+// Complementary error function after fdlibm s_erf.c (< 1 ulp). Each region
+// is its own branch-free function of a = |x|, so batch code can sort inputs
+// by region and run each as a vectorizable loop with bit-identical results.
+QUANT_CONSTEXPR double erfc_small(double a, bool negative) {
+    const double z = a * a;
+    const double y = horner(ERFC_PP, 5, z) / horner(ERFC_QQ, 6, z);
+    double t = a < 0.25 ? fmadd(a, y, a) : 0.5 + fmadd(a, y, a - 0.5);
+    if (a < 0x1p-56) t = a;
+    return negative ? 1.0 + t : 1.0 - t;
+}
+
+QUANT_CONSTEXPR double erfc_near(double a, bool negative) {
+    const double s = a - 1.0;
+    const double P = horner(ERFC_PA, 7, s);
+    const double Q = horner(ERFC_QA, 7, s);
+    return negative ? 1.0 + ERFC_ERX + P / Q : 1.0 - ERFC_ERX - P / Q;
+}
+
+// R/S of the two tail regions, in s = 1 / a^2
+QUANT_CONSTEXPR double erfc_mid_ratio(double a) {
+    const double s = 1.0 / (a * a);
+    return horner(ERFC_RA, 8, s) / horner(ERFC_SA, 9, s);
+}
+
+QUANT_CONSTEXPR double erfc_far_ratio(double a) {
+    const double s = 1.0 / (a * a);
+    return horner(ERFC_RB, 7, s) / horner(ERFC_SB, 8, s);
+}
+
+// Tail from the ratio: exp(-a^2) as exp(-z^2) exp((z - a)(z + a)) with
+// z = a cut to 20 bits
+QUANT_CONSTEXPR double erfc_tail(double a, bool negative, double ratio) {
+    const double z = from_bits(bits_of(a) & 0xFFFFFFFF00000000ull);
+    const double r = exp_split(-z * z - 0.5625, (z - a) * (z + a) + ratio);
+    return negative ? 2.0 - r / a : r / a;
+}
+
+// The same for a < ERFC_NORMAL_MAX, where exp(-a^2) stays a normal double
+QUANT_CONSTEXPR double erfc_tail_normal(double a, bool negative, double ratio) {
+    const double z = from_bits(bits_of(a) & 0xFFFFFFFF00000000ull);
+    const double r = exp_split_normal(-z * z - 0.5625, (z - a) * (z + a) + ratio);
+    return negative ? 2.0 - r / a : r / a;
+}
+
+QUANT_CONSTEXPR double erfc_portable(double x) {
+    if (x != x) return x;
+    const bool negative = x < 0.0;
+    const double a = abs(x);
+
+    if (a < ERFC_SMALL_MAX) return erfc_small(a, negative);
+    if (a < ERFC_NEAR_MAX) return erfc_near(a, negative);
+    if (a < ERFC_ZERO) {
+        if (negative && a > ERFC_TWO) return 2.0;
+        return erfc_tail(a, negative, a < ERFC_MID_MAX ? erfc_mid_ratio(a) : erfc_far_ratio(a));
+    }
+    return negative ? 2.0 : 0.0;
+}
+
+#if defined(QUANT_ENABLE_CONSTEXPR)
+QUANT_CONSTEXPR double exp(double x) { return exp_portable(x); }
+QUANT_CONSTEXPR double expm1(double x) { return expm1_portable(x); }
+QUANT_CONSTEXPR double log(double x) { return log_portable(x); }
+QUANT_CONSTEXPR double erfc(double x) { return erfc_portable(x); }
+QUANT_CONSTEXPR double sqrt(double x) { return sqrt_portable(x); }
+#else
+inline double exp(double x) { return std::exp(x); }
+inline double expm1(double x) { return std::expm1(x); }
+inline double log(double x) { return std::log(x); }
+inline double erfc(double x) { return std::erfc(x); }
+inline double sqrt(double x) { return std::sqrt(x); }
+#endif
+
+} // namespace detail
+
 class InverseCumulativeNormal {
   public:
-    explicit InverseCumulativeNormal(double average = 0.0, double sigma = 1.0)
+    explicit constexpr InverseCumulativeNormal(double average = 0.0, double sigma = 1.0)
     : average_(average), sigma_(sigma) {}
 
-    inline double operator()(double x) const {
+    QUANT_CONSTEXPR double operator()(double x) const {
         return average_ + sigma_ * standard_value(x);
     }
 
@@ -39,11 +666,128 @@ class InverseCumulativeNormal {
         }
     }
 
-    static inline double standard_value(double x) {
+    // Per-element parameters: out[i] = mu[i] + sigma[i] * Phi^{-1}(x[i]).
+    // The object's own average and sigma are not used. Works in blocks of
+    // TRANSFORM_BLOCK: standard quantiles go to out, then a separate sweep
+    // applies the affine step as one FMA per element while the block is
+    // still in L1, so that loop vectorizes.
+    inline void transform(const double* x, const double* mu, const double* sigma,
+                          double* out, size_t n) const {
+        for (size_t b = 0; b < n; b += TRANSFORM_BLOCK) {
+            const size_t end = min(n, b + TRANSFORM_BLOCK);
+            for (size_t i = b; i < end; ++i) {
+                out[i] = standard_value(x[i]);
+            }
+            for (size_t i = b; i < end; ++i) {
+                out[i] = detail::fmadd(sigma[i], out[i], mu[i]);
+            }
+        }
+    }
+
+    // Streams n quantiles through a tile buffer on the stack, for consumers
+    // that read each value once. The tile count m is fixed here, never more
+    // than the capacity, before source(tile, m) writes exactly m
+    // probabilities; the tile is transformed in place and handed to
+    // consumer(tile, m) before the next fill. tile_size is capped at
+    // MAX_TILE (16 KB of doubles, within L1).
+    template <class Source, class Consumer>
+    inline void generate_tiles(size_t n, Source source, size_t tile_size, Consumer consumer) const {
+        double tile[MAX_TILE];
+        const size_t capacity = min(max<size_t>(tile_size, 1), MAX_TILE);
+        for (size_t b = 0; b < n; b += capacity) {
+            const size_t m = min(n - b, capacity);
+            source(tile, m);
+            (*this)(tile, tile, m);
+            consumer(static_cast<const double*>(tile), m);
+        }
+    }
+
+    // One probability, many (mu, sigma): Phi^{-1}(x) is evaluated once
+    inline void transform(double x, const double* mu, const double* sigma,
+                          double* out, size_t n) const {
+        const double z = standard_value(x);
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = detail::fmadd(sigma[i], z, mu[i]);
+        }
+    }
+
+    // Strided batch, strides in elements: out[i * out_stride] =
+    // quantile(in[i * in_stride]), e.g. one field of an array of structs.
+    // Inputs are packed a block at a time into a stack buffer, run through
+    // the contiguous batch and scattered back, so no full-size copy is made.
+    inline void operator()(const double* in, size_t in_stride,
+                           double* out, size_t out_stride, size_t n) const {
+        double block[TRANSFORM_BLOCK];
+        for (size_t b = 0; b < n; b += TRANSFORM_BLOCK) {
+            const size_t m = min(n - b, TRANSFORM_BLOCK);
+            for (size_t i = 0; i < m; ++i) {
+                block[i] = in[(b + i) * in_stride];
+            }
+            (*this)(block, block, m);
+            for (size_t i = 0; i < m; ++i) {
+                out[(b + i) * out_stride] = block[i];
+            }
+        }
+    }
+
+    // Indexed batch over a subset of rows: out[index[i]] = quantile(in[index[i]])
+    // for i < n; entries of out not named by index are left untouched
+    inline void operator()(const double* in, const size_t* index, double* out, size_t n) const {
+        double block[TRANSFORM_BLOCK];
+        for (size_t b = 0; b < n; b += TRANSFORM_BLOCK) {
+            const size_t m = min(n - b, TRANSFORM_BLOCK);
+            for (size_t i = 0; i < m; ++i) {
+                block[i] = in[index[b + i]];
+            }
+            (*this)(block, block, m);
+            for (size_t i = 0; i < m; ++i) {
+                out[index[b + i]] = block[i];
+            }
+        }
+    }
+
+    // Row-major n_levels x n matrix out[k * n + i] = mu[i] + sigma[i] *
+    // Phi^{-1}(levels[k]): n_levels quantile evaluations, then an FMA sweep.
+    // Columns go in blocks of MATRIX_BLOCK so the mu and sigma slices stay in
+    // L1 across all levels while every row is written contiguously. Outputs of
+    // STREAM_MIN doubles or more are written with non-temporal stores on AVX
+    // targets: the matrix is not read back here, so it bypasses the caches
+    // instead of evicting mu and sigma.
+    inline void quantile_matrix(const double* levels, size_t n_levels,
+                                const double* mu, const double* sigma, size_t n,
+                                double* out) const {
+        if (n == 0) return;
+        // Park each standard quantile in the last column of its row; that
+        // entry is read before its row is swept and written by the last block
+        for (size_t k = 0; k < n_levels; ++k) {
+            out[k * n + n - 1] = standard_value(levels[k]);
+        }
+        const bool stream = n_levels * n >= STREAM_MIN;
+        for (size_t b = 0; b < n; b += MATRIX_BLOCK) {
+            const size_t end = min(n, b + MATRIX_BLOCK);
+            for (size_t k = 0; k < n_levels; ++k) {
+                double* row = out + k * n;
+                const double z = row[n - 1];
+                if (stream) {
+                    stream_fmadd(sigma, z, mu, row, b, end);
+                    continue;
+                }
+                for (size_t i = b; i < end; ++i) {
+                    row[i] = detail::fmadd(sigma[i], z, mu[i]);
+                }
+            }
+        }
+#if defined(__AVX__)
+        if (stream) _mm_sfence();
+#endif
+    }
+
+    static QUANT_CONSTEXPR double standard_value(double x) {
         if (x <= 0.0) return -numeric_limits<double>::infinity();
         if (x >= 1.0) return  numeric_limits<double>::infinity();
+        if (x < numeric_limits<double>::min()) return lower_from_log(detail::log(x));
 
-        double z;
+        double z = 0.0;
         if (x < x_low_ || x > x_high_) {
             z = tail_value(x);
         } else {
@@ -56,8 +800,298 @@ class InverseCumulativeNormal {
         return z;
     }
 
+    // Quantile with the density of N(average, sigma^2) at it, pdf =
+    // phi(z_std) / sigma. z matches operator() bit for bit; pdf comes from
+    // the density the last Halley step already evaluated, carried across
+    // that step, so no further exp is taken. dz/dx = 1 / pdf.
+    QUANT_CONSTEXPR void quantile_and_density(double x, double* z, double* pdf) const {
+        double p = 0.0;
+        const double s = standard_value_and_density(x, p);
+        *z = average_ + sigma_ * s;
+        *pdf = p / sigma_;
+    }
+
+    inline void quantile_and_density(const double* in, double* z, double* pdf, size_t n) const {
+        for (size_t i = 0; i < n; ++i) {
+            quantile_and_density(in[i], z + i, pdf + i);
+        }
+    }
+
+    // z = Phi^{-1}(x) scaled, dz/dx = sigma / phi and, when d2z_dx2 is not
+    // null, d2z/dx2 = sigma z_std / phi^2 for Hessian-based optimizers
+    QUANT_CONSTEXPR void quantile_derivatives(double x, double* z, double* dz_dx, double* d2z_dx2 = nullptr) const {
+        double p = 0.0;
+        const double s = standard_value_and_density(x, p);
+        *z = average_ + sigma_ * s;
+        *dz_dx = sigma_ / p;
+        if (d2z_dx2) *d2z_dx2 = sigma_ * s / (p * p);
+    }
+
+    inline void quantile_derivatives(const double* in, double* z, double* dz_dx, double* d2z_dx2,
+                                     size_t n) const {
+        for (size_t i = 0; i < n; ++i) {
+            quantile_derivatives(in[i], z + i, dz_dx + i, d2z_dx2 ? d2z_dx2 + i : nullptr);
+        }
+    }
+
+    // standard_value(x), also setting p = phi(z). The second Halley step
+    // moves z only slightly (|t| < 2e-6 below), so phi(z1) = phi(z0) exp(t)
+    // with t = -(z1 - z0)(z1 + z0)/2 is phi(z0)(1 + t + t^2/2) to rounding.
+    static QUANT_CONSTEXPR double standard_value_and_density(double x, double& p) {
+        if (x <= 0.0 || x >= 1.0 || x < numeric_limits<double>::min()) {
+            const double z = standard_value(x);
+            p = phi(z);
+            return z;
+        }
+
+        double z = 0.0;
+        if (x < x_low_ || x > x_high_) {
+            z = tail_value(x);
+        } else {
+            z = central_value(x);
+        }
+
+        z = halley_refine(z, x);
+        const double p0 = phi(z);
+        const double z1 = halley_step(z, x, p0);
+        const double t = -0.5 * (z1 - z) * (z1 + z);
+        p = detail::fmadd(p0, t * detail::fmadd(0.5, t, 1.0), p0);
+
+        return z1;
+    }
+
+    // Quantile from a survival probability: Phi^{-1}(1 - q) = -Phi^{-1}(q).
+    // 1 - q is never formed, so q far below 1e-16 keeps full precision.
+    QUANT_CONSTEXPR double from_q(double q) const {
+        return average_ - sigma_ * standard_value(q);
+    }
+
+    inline void from_q(const double* in, double* out, size_t n) const {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = average_ - sigma_ * standard_value(in[i]);
+        }
+    }
+
+    // Quantile of the uniform u = (bits + 1/2) / 2^64 taken straight from a
+    // raw 64-bit random word. The top bit selects the half and the other 63
+    // bits count from the nearer end of (0, 1), so m = min(u, 1 - u) is formed
+    // exactly down to 2^-65: the result is always finite and reaches |z| ~ 9,
+    // beyond the 2^-53 floor of a double uniform.
+    QUANT_CONSTEXPR double from_bits(uint64_t bits) const {
+        return average_ + sigma_ * standard_from_bits(bits);
+    }
+
+    inline void from_bits(const uint64_t* in, double* out, size_t n) const {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = average_ + sigma_ * standard_from_bits(in[i]);
+        }
+    }
+
+    static QUANT_CONSTEXPR double standard_from_bits(uint64_t bits) {
+        const bool upper = (bits >> 63) != 0;
+        const uint64_t k = upper ? ~bits : bits;
+        const double m = (double(k) + 0.5) * 0x1p-64;
+        
+        // m < 2^-lz: six or more leading zeros is always tail, four or fewer
+        // always central; only lz == 5 straddles x_low_
+        const int lz = leading_zeros(k);
+        const bool tail = lz > 5 || (lz == 5 && m < x_low_);
+        
+        double z = tail ? lower_tail_seed(detail::log_core(m)) : central_value(m);
+        z = halley_refine(z, m);
+        z = halley_refine(z, m);
+        
+        return upper ? -z : z;
+    }
+
+    // Quantile from a log-probability: Phi^{-1}(exp(log_p)). Reaches tail
+    // probabilities far below DBL_MIN and never forms p itself.
+    QUANT_CONSTEXPR double from_log_p(double log_p) const {
+        return average_ + sigma_ * standard_from_log_p(log_p);
+    }
+
+    // Quantile from a log survival probability: Phi^{-1}(1 - exp(log_q))
+    QUANT_CONSTEXPR double from_log_q(double log_q) const {
+        return average_ - sigma_ * standard_from_log_p(log_q);
+    }
+
+    inline void from_log_p(const double* in, double* out, size_t n) const {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = average_ + sigma_ * standard_from_log_p(in[i]);
+        }
+    }
+
+    inline void from_log_q(const double* in, double* out, size_t n) const {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = average_ - sigma_ * standard_from_log_p(in[i]);
+        }
+    }
+
+    static QUANT_CONSTEXPR double standard_from_log_p(double log_p) {
+        if (log_p >= 0.0) return numeric_limits<double>::infinity();
+        if (log_p > -detail::LN2) {
+            return -lower_from_log(detail::log(-detail::expm1(log_p)));
+        }
+        return lower_from_log(log_p);
+    }
+
+    // Quantiles of the regular grid x_i = (i + offset) / n, i = 0..n-1
+    // (offset 0.5 gives midpoints). Each point is seeded from its neighbour
+    // by a Taylor step and finished with a single Halley correction.
+    // Points above 0.5 are computed as -Phi^{-1}(1 - x_i), which is itself a
+    // grid with offset 1 - offset, so no walk ever works near x = 1.
+    inline void quantile_grid(size_t n, double offset, double* out) const {
+        if (n == 0) return;
+        const double h = 1.0 / double(n);
+        const double last_low = floor(0.5 * double(n) - offset);
+        const size_t n_low = last_low < 0.0 ? 0 : min(n, size_t(last_low) + 1);
+        
+        walk_grid(n_low, offset, h, 1.0, out, 1);
+        walk_grid(n - n_low, 1.0 - offset, h, -1.0, out + (n - 1), -1);
+    }
+
+    // Batch for sorted or nearly sorted input. Each element is seeded from
+    // the previous output with continue_from() instead of the rational
+    // approximation, falling back to standard_value() across large gaps.
+    // Chains run on m = min(x, 1 - x) and restart when x crosses 0.5, so the
+    // upper half is as accurate as the lower one. Any order gives correct
+    // results; the speedup comes from small gaps.
+    inline void warm_start(const double* in, double* out, size_t n) const {
+        const size_t len = (n + GRID_CHAINS - 1) / GRID_CHAINS;
+        double m[GRID_CHAINS] = {};
+        double z[GRID_CHAINS] = {};
+        double p[GRID_CHAINS] = {};
+        bool upper[GRID_CHAINS] = {};
+        
+        for (size_t t = 0; t < len; ++t) {
+            for (size_t c = 0; c < GRID_CHAINS; ++c) {
+                const size_t i = c * len + t;
+                if (i >= n) break;
+                const double xi = in[i];
+                const bool up = xi > 0.5;
+                const double mi = up ? 1.0 - xi : xi;
+                if (t > 0 && p[c] > 0.0 && up == upper[c]) {
+                    z[c] = continue_from(z[c], p[c], mi - m[c], mi);
+                } else {
+                    z[c] = standard_value(mi);
+                    p[c] = isfinite(z[c]) ? phi(z[c]) : 0.0;
+                }
+                m[c] = mi;
+                upper[c] = up;
+                out[i] = average_ + sigma_ * (up ? -z[c] : z[c]);
+            }
+        }
+    }
+
+    // Piecewise-polynomial engine for bulk batches: no transcendental calls
+    // and no refinement. m = min(x, 1 - x) is located by its IEEE exponent
+    // (octave) and leading SEGMENT_BITS mantissa bits (cell); the remaining
+    // mantissa bits give s in [-1, 1), and the cell's polynomial in s is the
+    // quantile. m below SEGMENT_M_MIN falls back to standard_value().
+    QUANT_CONSTEXPR double segmented(double x) const {
+        return average_ + sigma_ * segmented_value(x);
+    }
+
+    inline void segmented(const double* in, double* out, size_t n) const {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = average_ + sigma_ * segmented_value(in[i]);
+        }
+    }
+
+    static QUANT_CONSTEXPR double segmented_value(double x) {
+        if (x <= 0.0) return -numeric_limits<double>::infinity();
+        if (x >= 1.0) return  numeric_limits<double>::infinity();
+        
+        const bool upper = x > 0.5;
+        const double m = upper ? 1.0 - x : x;
+        if (!(m >= SEGMENT_M_MIN)) return standard_value(x);
+        if (m == 0.5) return 0.0;
+        
+        // m in [2^-(octave + 2), 2^-(octave + 1))
+        const uint64_t bits = detail::bits_of(m);
+        const size_t octave = size_t(1021 - int(bits >> 52));
+        const size_t cell = (octave << SEGMENT_BITS) | size_t((bits >> SEGMENT_SHIFT) & SEGMENT_CELL_MASK);
+        const double s = double(bits & SEGMENT_FRACTION_MASK) * SEGMENT_SCALE - 1.0;
+        const double* c = &SEGMENT_COEFFS[cell * (SEGMENT_DEGREE + 1)];
+        
+        double z = c[SEGMENT_DEGREE];
+        for (int i = SEGMENT_DEGREE - 1; i >= 0; --i) {
+            z = detail::fmadd(z, s, c[i]);
+        }
+        
+        return upper ? -z : z;
+    }
+
   private:
-    static inline double central_value(double x) {
+    // row[i] = sigma[i] * z + mu[i] for i in [b, end), bit-identical to the
+    // fmadd sweep, with 32-byte aligned non-temporal stores on AVX targets
+    static inline void stream_fmadd(const double* sigma, double z, const double* mu,
+                                    double* row, size_t b, size_t end) {
+        size_t i = b;
+#if defined(__AVX__)
+        for (; i < end && (reinterpret_cast<uintptr_t>(row + i) & 31) != 0; ++i) {
+            row[i] = detail::fmadd(sigma[i], z, mu[i]);
+        }
+        const __m256d zv = _mm256_set1_pd(z);
+        for (; i + 4 <= end; i += 4) {
+#if defined(__FMA__)
+            const __m256d y = _mm256_fmadd_pd(_mm256_loadu_pd(sigma + i), zv, _mm256_loadu_pd(mu + i));
+#else
+            const __m256d y = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(sigma + i), zv), _mm256_loadu_pd(mu + i));
+#endif
+            _mm256_stream_pd(row + i, y);
+        }
+#endif
+        for (; i < end; ++i) {
+            row[i] = detail::fmadd(sigma[i], z, mu[i]);
+        }
+    }
+
+    // Walk x_j = (j + offset) * h for j < count, writing sign * Phi^{-1}(x_j)
+    // to out[j * stride]. The range is split into GRID_CHAINS contiguous
+    // segments walked in lockstep so their dependency chains overlap.
+    inline void walk_grid(size_t count, double offset, double h, double sign,
+                          double* out, ptrdiff_t stride) const {
+        const size_t len = (count + GRID_CHAINS - 1) / GRID_CHAINS;
+        double z[GRID_CHAINS] = {};
+        double p[GRID_CHAINS] = {};
+        
+        for (size_t t = 0; t < len; ++t) {
+            for (size_t c = 0; c < GRID_CHAINS; ++c) {
+                const size_t j = c * len + t;
+                if (j >= count) break;
+                const double x = (double(j) + offset) * h;
+                if (t > 0 && p[c] > 0.0) {
+                    z[c] = continue_from(z[c], p[c], h, x);
+                } else {
+                    z[c] = standard_value(x);
+                    p[c] = isfinite(z[c]) ? phi(z[c]) : 0.0;
+                }
+                out[ptrdiff_t(j) * stride] = average_ + sigma_ * (sign * z[c]);
+            }
+        }
+    }
+
+    // Step from a known quantile z = Phi^{-1}(x - dx) with density p = phi(z)
+    // to Phi^{-1}(x): second-order Taylor seed (dz/dx = 1/phi(z),
+    // d2z/dx2 = z/phi(z)^2) plus one Halley step; p is updated to the new
+    // density. Falls back to the full evaluation when the step is too long
+    // for one Halley step to converge.
+    static inline double continue_from(double z, double& p, double dx, double x) {
+        const double dz = dx / p;
+        if (!(abs(dz) * (1.0 + abs(z)) < CONTINUATION_LIMIT) || x <= 0.0 || x >= 1.0) {
+            const double z_full = standard_value(x);
+            p = isfinite(z_full) ? phi(z_full) : 0.0;
+            return z_full;
+        }
+        const double seed = z + dz * (1.0 + 0.5 * z * dz);
+        const double p_seed = phi(seed);
+        const double z_new = halley_step(seed, x, p_seed);
+        p = p_seed * (1.0 - 0.5 * (z_new - seed) * (z_new + seed));
+        return z_new;
+    }
+
+    static QUANT_CONSTEXPR double central_value(double x) {
         const double u = x - 0.5;
         const double r = u * u;
         
@@ -74,70 +1108,152 @@ class InverseCumulativeNormal {
         return u * P / Q;
     }
 
-    static inline double tail_value(double x) {
+    static QUANT_CONSTEXPR double tail_value(double x) {
         const double m = min(x, 1.0 - x);
-        const double t = sqrt(-2.0 * log(m));
         const double s = (x < 0.5) ? -1.0 : 1.0;
         
+        return -s * lower_tail_seed(detail::log_core(m));
+    }
+
+
+    // Seed for Phi^{-1}(m), m < x_low_, from log m: the fitted rational in
+    // t = sqrt(-2 log m) within its range, and past it the asymptotic root
+    // of Phi(z) ~ phi(z) / |z|, z^2 ~ t^2 - log(2 pi t^2)
+    static QUANT_CONSTEXPR double lower_tail_seed(double log_m) {
+        const double t = detail::sqrt(-2.0 * log_m);
+        if (t > TAIL_T_MAX) {
+            return -detail::sqrt(t * t - detail::log_core(TWO_PI * t * t));
+        }
+        
         double C = TAIL_C[TAIL_P];
         for (int i = TAIL_P - 1; i >= 0; --i) {
-            C = C * t + TAIL_C[i];
+            C = detail::fmadd(C, t, TAIL_C[i]);
         }
         
         double D = TAIL_D[TAIL_Q];
         for (int i = TAIL_Q - 1; i >= 0; --i) {
-            D = D * t + TAIL_D[i];
+            D = detail::fmadd(D, t, TAIL_D[i]);
         }
         
-        return s * C / D;
+        return -C / D;
+    }
+
+    static QUANT_CONSTEXPR int leading_zeros(uint64_t k) {
+#if defined(__GNUC__)
+        return k ? __builtin_clzll(k) : 64;
+#else
+        int n = 64;
+        while (k) {
+            k >>= 1;
+            --n;
+        }
+        return n;
+#endif
     }
 
-    static inline double halley_refine(double z, double x) {
-        const double r = compute_stable_residual(z, x);
-        const double denom = 1.0 - 0.5 * z * r;
+    // Phi^{-1}(exp(log_m)) for log_m <= -log 2, refined in log space
+    static QUANT_CONSTEXPR double lower_from_log(double log_m) {
+        if (log_m == -numeric_limits<double>::infinity()) {
+            return -numeric_limits<double>::infinity();
+        }
         
-        if (abs(denom) < numeric_limits<double>::min()) {
-            return z - copysign(numeric_limits<double>::infinity(), r);
+        double z = 0.0;
+        if (log_m >= LOG_X_LOW) {
+            z = central_value(detail::exp(log_m));
+        } else {
+            z = lower_tail_seed(log_m);
+        }
+        
+        z = log_halley_refine(z, log_m);
+        z = log_halley_refine(z, log_m);
+        
+        return z;
+    }
+
+    // Halley step on f(z) = log Phi(z) - log_m, where f' = h = phi(z)/Phi(z)
+    // and f'' = -h (z + h). Like the expm1 tail residual, the mismatch is
+    // measured as a log ratio, so it never underflows.
+    static QUANT_CONSTEXPR double log_halley_refine(double z, double log_m) {
+        const double log_cdf = log_Phi(z);
+        const double f = log_cdf - log_m;
+        const double h = detail::exp(-0.5 * z * z - LOG_SQRT_2PI - log_cdf);
+        
+        return z - (f / h) / (1.0 + 0.5 * f * (z + h) / h);
+    }
+
+    // log Phi(z) for z <= 0. Below LOG_PHI_ASYMPTOTIC, where erfc underflows,
+    // uses Phi(z) = phi(z)/|z| * (1 - 1/z^2 + 3/z^4 - 15/z^6 + ...).
+    static QUANT_CONSTEXPR double log_Phi(double z) {
+        if (z > LOG_PHI_ASYMPTOTIC) {
+            return detail::log(Phi(z));
+        }
+        
+        const double w = 1.0 / (z * z);
+        double S = 1.0;
+        for (int k = LOG_PHI_TERMS; k >= 1; --k) {
+            S = 1.0 - (2 * k - 1) * w * S;
+        }
+        
+        return -0.5 * z * z - detail::log(-z) - LOG_SQRT_2PI + detail::log(S);
+    }
+
+    static QUANT_CONSTEXPR double halley_refine(double z, double x) {
+        return halley_step(z, x, phi(z));
+    }
+
+    // Halley step with the density p = phi(z) already known
+    static QUANT_CONSTEXPR double halley_step(double z, double x, double p) {
+        const double r = compute_stable_residual(z, x, p);
+        const double denom = 1.0 + 0.5 * z * r;
+        
+        if (detail::abs(denom) < numeric_limits<double>::min()) {
+            return r < 0.0 ? numeric_limits<double>::infinity() : -numeric_limits<double>::infinity();
         }
         
         return z - r / denom;
     }
 
-    static inline double compute_stable_residual(double z, double x) {
+    static QUANT_CONSTEXPR double compute_stable_residual(double z, double x, double p) {
         constexpr double TAIL_THRESHOLD = 1e-8;
-        const double p = phi(z);
         
-        if (x >= TAIL_THRESHOLD && x <= 1.0 - TAIL_THRESHOLD) {
+        if (x >= TAIL_THRESHOLD && x <= 0.5) {
             const double f = Phi(z);
             return (f - x) / max(p, numeric_limits<double>::min());
         }
         
+        // Upper half: Phi(z) - x = (1 - x) - Q(z), where 1 - x is exact
+        // for x >= 0.5 and Q(z) keeps its relative precision
+        if (x > 0.5 && x <= 1.0 - TAIL_THRESHOLD) {
+            const double y = 1.0 - x;
+            return (y - Q(z)) / max(p, numeric_limits<double>::min());
+        }
+        
         if (x < 0.5) {
             const double y = x;
-            const double log_q = log(Q(-z));
-            const double log_y = log(y);
-            return y * expm1(log_q - log_y) / max(p, numeric_limits<double>::min());
+            const double log_q = detail::log(Q(-z));
+            const double log_y = detail::log(y);
+            return y * detail::expm1(log_q - log_y) / max(p, numeric_limits<double>::min());
         } else {
             const double y = 1.0 - x;
-            const double log_q = log(Q(z));
-            const double log_y = log(y);
-            return -y * expm1(log_q - log_y) / max(p, numeric_limits<double>::min());
+            const double log_q = detail::log(Q(z));
+            const double log_y = detail::log(y);
+            return -y * detail::expm1(log_q - log_y) / max(p, numeric_limits<double>::min());
         }
     }
 
-    static inline double phi(double z) {
+    static QUANT_CONSTEXPR double phi(double z) {
         constexpr double INV_SQRT_2PI = 0.398942280401432677939946059934381868475858631164934657;
-        return INV_SQRT_2PI * exp(-0.5 * z * z);
+        return INV_SQRT_2PI * detail::exp(-0.5 * z * z);
     }
 
-    static inline double Phi(double z) {
+    static QUANT_CONSTEXPR double Phi(double z) {
         constexpr double INV_SQRT_2 = 0.707106781186547524400844362104849039284835937688474036588;
-        return 0.5 * erfc(-z * INV_SQRT_2);
+        return 0.5 * detail::erfc(-z * INV_SQRT_2);
     }
 
-    static inline double Q(double z) {
+    static QUANT_CONSTEXPR double Q(double z) {
         constexpr double INV_SQRT_2 = 0.707106781186547524400844362104849039284835937688474036588;
-        return 0.5 * erfc(z * INV_SQRT_2);
+        return 0.5 * detail::erfc(z * INV_SQRT_2);
     }
 
     // ===== COEFFICIENTS FROM JSON =====
@@ -145,58 +1261,589 @@ class InverseCumulativeNormal {
     // Central region: degree (6, 6)
     static constexpr int CENTRAL_M = 6;
     static constexpr double CENTRAL_A[7] = {
-        2.506632854490859597e+00,
-        -1.422236589581395627e+01,
-        1.443940992231501674e+01,
-        1.125587850479905505e+01,
-        6.235951994187552749e+00,
-        5.360984236954892346e+00,
-        1.548292849870007259e+00
+        2.506632849057846890e+00,
+        -1.422413795809762149e+01,
+        1.444836688826551629e+01,
+        1.124785118700589770e+01,
+        6.233761734528333598e+00,
+        5.357641348895292310e+00,
+        1.547684399818526124e+00
     };
 
     static constexpr int CENTRAL_N = 6;
     static constexpr double CENTRAL_B[7] = {
         1.000000000000000000e+00,
-        -6.720907494037536622e+00,
-        1.049064736555859056e+01,
-        2.770230007345471090e+00,
-        -1.235906088649952661e+00,
-        -4.071878664464104070e+00,
-        9.604872394541887903e-01
+        -6.721614705626185682e+00,
+        1.049496977648114360e+01,
+        2.764021938788094879e+00,
+        -1.235283103372704083e+00,
+        -4.073658561228690189e+00,
+        9.578239105003393261e-01
     };
 
     // Tail region: degree (8, 8)
     static constexpr int TAIL_P = 8;
     static constexpr double TAIL_C[9] = {
-        -1.858032981648610305e+00,
-        2.588225612061147984e+00,
-        -9.458143568290986458e-01,
-        9.635777642798729059e-02,
-        -1.093361782182804796e-02,
-        1.151095845392377612e-03,
-        -7.697710330474194962e-05,
-        7.091999104160253720e-06,
-        -1.637883410810526020e-06
+        -1.715896778930315669e+00,
+        3.681224266153670044e+00,
+        -2.146768920415258020e+00,
+        2.703822756775975944e-01,
+        -4.226015959360847341e-02,
+        3.691632144025704804e-03,
+        -1.599818899573090310e-04,
+        3.437546232481653458e-05,
+        -6.368113709511126501e-06
     };
 
     static constexpr int TAIL_Q = 8;
     static constexpr double TAIL_D[9] = {
         1.000000000000000000e+00,
-        -3.643167149463678034e-01,
-        -5.972810066061043366e-02,
-        1.917808555073034077e-02,
-        -2.882548470945496110e-03,
-        2.860918773389828037e-04,
-        -1.430583773078767941e-05,
-        -9.340241703516925078e-07,
-        -9.914343700468198135e-09
+        -1.071360404190591753e+00,
+        -5.205378324535813589e-02,
+        2.618894046260365413e-02,
+        -6.415908040757073612e-03,
+        8.658713821969499149e-04,
+        -3.510358691656890632e-05,
+        -3.703712865178986724e-06,
+        -4.521874677974451217e-08
+    };
+
+    // Segmented region: octave o covers m in [2^-(o+2), 2^-(o+1)), split into
+    // 2^SEGMENT_BITS cells; each cell stores SEGMENT_DEGREE + 1 monomial
+    // coefficients in s, lowest first, contiguously
+    static constexpr int SEGMENT_BITS = 3;
+    static constexpr int SEGMENT_DEGREE = 10;
+    static constexpr int SEGMENT_OCTAVES = 63;
+    static constexpr int SEGMENT_SHIFT = 52 - SEGMENT_BITS;
+    static constexpr uint64_t SEGMENT_CELL_MASK = (uint64_t(1) << SEGMENT_BITS) - 1;
+    static constexpr uint64_t SEGMENT_FRACTION_MASK = (uint64_t(1) << SEGMENT_SHIFT) - 1;
+    static constexpr double SEGMENT_SCALE = 0x1p-48;
+    static constexpr double SEGMENT_M_MIN = 0x1p-64;
+    static constexpr double SEGMENT_COEFFS[5544] = {
+        -6.260990123464211798e-01, 4.764657339049848533e-02, -7.106837228971903900e-04, 3.216167101356176463e-05, -1.257369608828294987e-06, 5.877066009436785607e-08, -2.779915556838392162e-09, 1.377294911019257080e-10, -6.957192271520393531e-12, 3.612783203061153422e-13, -1.887882143050411989e-14,
+        -5.334097062412805901e-01, 4.515376595241365337e-02, -5.437745448481512032e-04, 2.407509291213311866e-05, -8.044552356709069694e-07, 3.446077690532823762e-08, -1.440848418383145249e-09, 6.420615940673302076e-11, -2.893636360447734706e-12, 1.343601295740331445e-13, -6.277189700647070061e-15,
+        -4.450965249855163286e-01, 4.324433262001686762e-02, -4.161813419355377239e-04, 1.881874995873902956e-05, -5.310958273188201186e-07, 2.149402825168083796e-08, -7.936037894858529222e-10, 3.241299776362328466e-11, -1.312078828090531478e-12, 5.525016635356344374e-14, -2.330460914158534142e-15,
+        -3.601298917895693896e-01, 4.179001762901063399e-02, -3.144664250905671379e-04, 1.531883172471388961e-05, -3.559713844269094445e-07, 1.420037145478495518e-08, -4.563685120657645976e-10, 1.754354331949665196e-11, -6.363607356303411383e-13, 2.471688268380277393e-14, -9.454120396294078794e-16,
+        -2.776904398215767622e-01, 4.070564249219409125e-02, -2.300594942023968207e-04, 1.297485990262509304e-05, -2.370622977779989953e-07, 9.955518735745566648e-09, -2.681806277412492955e-10, 1.016634477534763356e-11, -3.234696217417493194e-13, 1.193989931327040584e-14, -4.107948522696714787e-16,
+        -1.970990842943123322e-01, 3.993426604028608995e-02, -1.571614491327689078e-04, 1.143884514292635687e-05, -1.510706016642500914e-07, 7.467494418458539075e-09, -1.552655293706923268e-10, 6.378789928036794985e-12, -1.667246832976714414e-13, 6.273885345635650630e-15, -1.857330285601956876e-16,
+        -1.177698745790952961e-01, 3.943862241530251417e-02, -9.158992223497212568e-05, 1.050744202753138830e-05, -8.408926454672923213e-08, 6.076730727455985459e-09, -8.096647460587002891e-11, 4.464750399641128583e-12, -8.007657091463029651e-14, 3.725627821531436337e-15, -8.096367190872974993e-17,
+        -3.917608550309763238e-02, 3.919613369352100557e-02, -3.009383280982288878e-05, 1.006721814413113140e-05, -2.700546770901882746e-08, 5.451231165973754662e-09, -2.515707872306439711e-11, 3.657065183606723728e-12, -2.383620239465284976e-14, 2.729823176207678670e-15, -2.287057229549510207e-17,
+        -1.113194277160928669e+00, 3.638891872342431971e-02, -7.370199967432418701e-04, 2.793419105304136547e-05, -1.173976498732605556e-06, 5.362601775497557552e-08, -2.567519550460920032e-09, 1.270342773893509482e-10, -6.436467332033358833e-12, 3.346038634275165164e-13, -1.751105924600626500e-14,
+        -1.043158263318453738e+00, 3.374232990552140932e-02, -5.938412224580631553e-04, 2.033777511097043214e-05, -7.622673771526327134e-07, 3.115555666823580175e-08, -1.333960761613387751e-09, 5.903576577943119984e-11, -2.675567969039237269e-12, 1.242303326832876453e-13, -5.815701091404562914e-15,
+        -9.778975439405418468e-01, 3.158888605122532611e-02, -4.879013077520729063e-04, 1.530127567341580815e-05, -5.167856319542975379e-07, 1.911768873047490663e-08, -7.401711645859325741e-10, 2.962979066354538533e-11, -1.214648059215337249e-12, 5.095892094039790773e-14, -2.157931148289534329e-15,
+        -9.165566675331128232e-01, 2.980575842753056467e-02, -4.071267888837272822e-04, 1.182793002884132728e-05, -3.629039959068106961e-07, 1.226766591820299821e-08, -4.333749292089102222e-10, 1.583679675967875742e-11, -5.926137163169309889e-13, 2.267702894825558025e-14, -8.766212569751404726e-16,
+        -8.584844741418322656e-01, 2.830847824575948371e-02, -3.439818260205126086e-04, 9.353980698809329609e-06, -2.623786238163380933e-07, 8.171349319974446101e-09, -2.653536197169822367e-10, 8.920056905698594751e-12, -3.070081974397367530e-13, 1.079935511652536404e-14, -3.840032165582425577e-16,
+        -8.031725655979178313e-01, 2.703700905895405418e-02, -2.935595160437268875e-04, 7.543846699502903558e-06, -1.943938004837920554e-07, 5.617824748723548447e-09, -1.687338497843756838e-10, 5.251996292888644386e-12, -1.673264320724580137e-13, 5.446332927304653739e-15, -1.792854941630149045e-16,
+        -7.502153754679404818e-01, 2.594749577585469050e-02, -2.525497045831068895e-04, 6.189079823175264599e-06, -1.470367070967234244e-07, 3.968888273434162197e-09, -1.108204398029569770e-10, 3.212107164675345778e-12, -9.524812124557155599e-14, 2.884930119338544174e-15, -8.840389531967141666e-17,
+        -6.992833023832198958e-01, 2.500715832201046152e-02, -2.186511922873197111e-04, 5.155452747215217337e-06, -1.131938146092701385e-07, 2.871352166741189591e-09, -7.484540115847568837e-11, 2.030367119985874997e-12, -5.629844094415978703e-14, 1.594556647017448294e-15, -4.570242426740119350e-17,
+        -1.503102943129273950e+00, 3.030084489739967232e-02, -6.900303710886469041e-04, 2.558849753640732994e-05, -1.085258410626531128e-06, 4.968924335287051502e-08, -2.385034277788157116e-09, 1.182307319617201211e-10, -6.000015281855749065e-12, 3.123435396834764949e-13, -1.636528578417038624e-14,
+        -1.445072579818074354e+00, 2.781662179114674158e-02, -5.590728934287325560e-04, 1.856930150963168212e-05, -7.040200902116951156e-07, 2.882776841374074127e-08, -1.237594384061345897e-09, 5.487636225168534892e-11, -2.491136528310499030e-12, 1.158289303445516237e-13, -5.428911053223170391e-15,
+        -1.391537487995900602e+00, 2.578272407018735238e-02, -4.625114797298335257e-04, 1.391904900285951116e-05, -4.770214968433206067e-07, 1.766533607236928163e-08, -6.859239226695914586e-10, 2.751074361069856020e-11, -1.129671567631969748e-12, 4.746126172580640804e-14, -2.012279974700477044e-15,
+        -1.341717841080253937e+00, 2.408573484845205614e-02, -3.891804367741084555e-04, 1.071335077670653215e-05, -3.349190318027670215e-07, 1.132034241724866766e-08, -4.012063742135665479e-10, 1.468854913342249673e-11, -5.505929753364591274e-13, 2.109938482218747976e-14, -8.166522164172371933e-16,
+        -1.295022406705814477e+00, 2.264769055870117023e-02, -3.321200786487444028e-04, 8.429959849751196367e-06, -2.422168488019057405e-07, 7.529674437388099505e-09, -2.454389069335360929e-10, 8.264998478198681529e-12, -2.849698147544880693e-13, 1.003865389401594732e-14, -3.574073997056358121e-16,
+        -1.250991715462545173e+00, 2.141317750510816215e-02, -2.868049695458928304e-04, 6.758308363391023551e-06, -1.796153618261346294e-07, 5.168635182573487599e-09, -1.559542131661329550e-10, 4.861604894956111730e-12, -1.551792673803812949e-13, 5.058253712731330528e-15, -1.667258034655450068e-16,
+        -1.209261231709154671e+00, 2.034169521323996380e-02, -2.501868158521345547e-04, 5.505647399696925108e-06, -1.360804985915522112e-07, 3.645013313891176788e-09, -1.023691224715130356e-10, 2.970503708979829543e-12, -8.826248588031795013e-14, 2.677137683541742471e-15, -8.214493945916098175e-17,
+        -1.169536610207142946e+00, 1.940293433503336232e-02, -2.201499815014373580e-04, 4.547943398416417693e-06, -1.050298610100105201e-07, 2.631355248445029112e-09, -6.911496106968728670e-11, 1.875805129050200077e-12, -5.213151029592671088e-14, 1.478527556823866364e-15, -4.243474269869793011e-17,
+        -1.835671536912543589e+00, 2.639604485585785726e-02, -6.395031584192502989e-04, 2.372310289897229817e-05, -1.010642612720397394e-06, 4.640064492031710500e-08, -2.231906779792316585e-09, 1.108263040188727129e-10, -5.632063614547730237e-12, 2.935377295085852172e-13, -1.539551842209502370e-14,
+        -1.785262490435323590e+00, 2.409369690373079631e-02, -5.181779993778705884e-04, 1.719021511360558477e-05, -6.548279529119349710e-07, 2.688843333379080757e-08, -1.156842162959810858e-09, 5.138415939242997089e-11, -2.335924391444180646e-12, 1.087441527772047054e-13, -5.102135591584239102e-15,
+        -1.739019971729903746e+00, 2.220826280793223445e-02, -4.288483567725746024e-04, 1.286713570177302241e-05, -4.432061585112174137e-07, 1.645924988759138812e-08, -6.405090337182814037e-10, 2.573446531711092286e-11, -1.058267743651564703e-12, 4.451648128955401285e-14, -1.889428447699377002e-15,
+        -1.696222505006609538e+00, 2.063429671316368424e-02, -3.611038907638390344e-04, 9.890102277495427957e-06, -3.108674171918433053e-07, 1.053696019071304395e-08, -3.742860030673798132e-10, 1.372751641109147904e-11, -5.153311180154188097e-13, 1.977304241252283111e-14, -7.661443574811990440e-16,
+        -1.656323865340807444e+00, 1.929939137802131471e-02, -3.084625827575775072e-04, 7.771614842837542474e-06, -2.246181548922614985e-07, 7.002098787678794542e-09, -2.287672057189520016e-10, 7.717610225074788354e-12, -2.664972139029031978e-13, 9.399969113516112938e-15, -3.350370176241620341e-16,
+        -1.618900143537359337e+00, 1.815213209335431871e-02, -2.667137173260416844e-04, 6.222040808457632110e-06, -1.664269991926185562e-07, 4.802290665560783305e-09, -1.452400840248015412e-10, 4.535966213983417912e-12, -1.450066401685828361e-13, 4.732824974161145184e-15, -1.561740587048737448e-16,
+        -1.583615475801788408e+00, 1.715497424069495000e-02, -2.330235864124551969e-04, 5.061781500832542531e-06, -1.259936992668169962e-07, 3.383863488543080555e-09, -9.526181708427164658e-11, 2.769430714193444551e-12, -8.241574599604019563e-14, 2.503100773162912800e-15, -7.689216282457851621e-17,
+        -1.550199040791760963e+00, 1.627984305518704808e-02, -2.054271758916120360e-04, 4.175360087234581148e-06, -9.717850952730177143e-08, 2.440910262976178805e-09, -6.426900638369836044e-11, 1.747576311816690656e-12, -4.864423518188246140e-14, 1.381470169533933791e-15, -3.969485425018842928e-17,
+        -2.129618469119812119e+00, 2.363809058111753653e-02, -5.949720905631980354e-04, 2.216864261470146062e-05, -9.477944034288399461e-07, 4.362078332272186003e-08, -2.102023615270985837e-09, 1.045279241286422793e-10, -5.318308832763877155e-12, 2.774672763530944328e-13, -1.456524888031440680e-14,
+        -2.084558718407909517e+00, 2.149702453493932547e-02, -4.816602885896149530e-04, 1.604508775440220445e-05, -6.134523490921977116e-07, 2.525206947295925473e-08, -1.088472499396256211e-09, 4.841906995945392514e-11, -2.203817606660057245e-12, 1.027010261089261775e-13, -4.822878590231212217e-15,
+        -2.043372020942648692e+00, 1.974512478552387790e-02, -3.983246766746961244e-04, 1.199704551472512903e-05, -4.147952581393960921e-07, 1.544323346455620546e-08, -6.021204725803645988e-10, 2.422878729367224386e-11, -9.975940411246940356e-13, 4.200883524942250544e-14, -1.784615475465701888e-15,
+        -2.005385271924902568e+00, 1.828364694932455708e-02, -3.351918717441494514e-04, 9.212054367083374748e-06, -2.906758307223559116e-07, 9.878006966512456237e-09, -3.515637793785938093e-10, 1.291410544773351421e-11, -4.854132816394989986e-13, 1.864529448889055991e-14, -7.231177481089665158e-16,
+        -1.970089404757873197e+00, 1.704485055635245050e-02, -2.861820137760005822e-04, 7.231969708041880888e-06, -2.098510307769933220e-07, 6.558926656505148495e-09, -2.147139367057725206e-10, 7.254935856279073312e-12, -2.508457398638821604e-13, 8.857667141455659730e-15, -3.160065582679503819e-16,
+        -1.937089736546502294e+00, 1.598067740601621586e-02, -2.473489743205885012e-04, 5.784820613155645899e-06, -1.553623697538157012e-07, 4.494950502274588514e-09, -1.362194742931575549e-10, 4.261067262401963116e-12, -1.363984702487666071e-13, 4.456858653173225980e-15, -1.472091843787512838e-16,
+        -1.906073849231759043e+00, 1.505606298098952078e-02, -2.160392062183596996e-04, 4.702088160738865658e-06, -1.175295662237349335e-07, 3.165045092737151184e-09, -8.928439351605622898e-11, 2.599883686801680771e-12, -7.747395943564747305e-14, 2.355690351518005199e-15, -7.243464411784719861e-17,
+        -1.876790047981099718e+00, 1.424480741941365133e-02, -1.904139931450846254e-04, 3.875496645100980727e-06, -9.058639184141713557e-08, 2.281528683612287387e-09, -6.019742460337973317e-11, 1.639567813127828469e-12, -4.569990935253417072e-14, 1.299352225108505151e-15, -3.737234876722132657e-17,
+        -2.395415011067751454e+00, 2.156520990506963914e-02, -5.570037903703436424e-04, 2.085384278599311883e-05, -8.942914402103154537e-07, 4.124405857017482916e-08, -1.990594576634721124e-09, 9.910924499056823254e-11, -5.047738115904826234e-12, 2.635801838577705153e-13, -1.384650799628099081e-14,
+        -2.354358880412856347e+00, 1.956178063391171215e-02, -4.504633240416948577e-04, 1.507845711426766220e-05, -5.782924561183173613e-07, 2.385556290630108799e-08, -1.029923078003768301e-09, 4.587268007688134074e-11, -2.090094751504635424e-12, 9.748806295837775310e-14, -4.581551243353555232e-15,
+        -2.316925094618596415e+00, 1.792409277737725889e-02, -3.721828559997980438e-04, 1.126395486645311226e-05, -3.906911775487284783e-07, 1.457757079975846532e-08, -5.692996618328637240e-10, 2.293782375934246808e-11, -9.454474901274650390e-13, 3.984911205853789444e-14, -1.694180923408116047e-15,
+        -2.282481347147924389e+00, 1.655909298577177766e-02, -3.129322560944500947e-04, 8.641781372216633523e-06, -2.735697951353039624e-07, 9.317408620038628548e-09, -3.321661434872287725e-10, 1.221772459413996577e-11, -4.597379380145075919e-13, 1.767543168819513106e-14, -6.860471456894632445e-16,
+        -2.250549854713513209e+00, 1.540299776133736802e-02, -2.669741096989648732e-04, 6.778876040407380415e-06, -1.973568041179238098e-07, 6.182419404498315760e-09, -2.027333380051180591e-10, 6.859370588772135947e-12, -2.374319376364853935e-13, 8.391915366051350568e-15, -2.996322645778568993e-16,
+        -2.220760496646473570e+00, 1.441059093377549880e-02, -2.305872597951605157e-04, 5.418337617682506799e-06, -1.460117891885990322e-07, 4.234172794557964412e-09, -1.285390447881632465e-10, 4.026338945358959575e-12, -1.290302831587185741e-13, 4.220143396211352086e-15, -1.395051331062482700e-16,
+        -2.192820525554396660e+00, 1.354890530378812484e-02, -2.012711401854726505e-04, 4.401088165120662641e-06, -1.103842668045864882e-07, 2.979595671359309079e-09, -8.420102676248618519e-11, 2.455283011979509663e-12, -7.324898609843610514e-14, 2.229393809791718463e-15, -6.860846508921774005e-17,
+        -2.166494266695716764e+00, 1.279332473530371030e-02, -1.772941459858212916e-04, 3.624980378090458665e-06, -8.502680208938604429e-08, 2.146599653991727863e-09, -5.673864466924844814e-11, 1.547552691438555198e-12, -4.318542736713438842e-14, 1.229073111992293956e-15, -3.538095489957349118e-17,
+        -2.639584150753406799e+00, 1.993804847574193531e-02, -5.246513702703289395e-04, 1.972860440564065345e-05, -8.482308784330238638e-07, 3.918933349531458414e-08, -1.893949218311069138e-09, 9.439716454503659141e-11, -4.811935761483982868e-12, 2.514547108234729174e-13, -1.321792326522413770e-14,
+        -2.601661258329095006e+00, 1.805185224585075313e-02, -4.239008569599794361e-04, 1.425270490440934724e-05, -5.480770609502696380e-07, 2.265035087943244062e-08, -9.792277699455431135e-10, 4.366201899116259945e-11, -1.991146767675155944e-12, 9.294368559717354156e-14, -4.370828353833759445e-15,
+        -2.567147237596024922e+00, 1.651138454180801907e-02, -3.499353096972886504e-04, 1.063874648190483092e-05, -3.700101156770154976e-07, 1.383166625435934575e-08, -5.409255154969302933e-10, 2.181876484864049453e-11, -9.001432727431441374e-13, 3.796914061499662901e-14, -1.615328863228620103e-15,
+        -2.535444609366894309e+00, 1.522847954535715663e-02, -2.939931558122259574e-04, 8.156170693634377103e-06, -2.589145409599537533e-07, 8.835063952540863001e-09, -3.154203610938059809e-10, 1.161491444482155773e-11, -4.374620625426581294e-13, 1.683233448299292122e-14, -6.537672982552535224e-16,
+        -2.506102252248701756e+00, 1.414274674062641207e-02, -2.506318846765864024e-04, 6.393591208844474432e-06, -1.866670889031786732e-07, 5.858901437194263650e-09, -1.924041848116937115e-10, 6.517397780974050254e-12, -2.258089009952310027e-13, 7.987545312963159812e-15, -2.853916209916646126e-16,
+        -2.478770948298702148e+00, 1.321140342565875828e-02, -2.163238037222249316e-04, 5.107109808766534100e-06, -1.380216927310918826e-07, 4.010374699340906961e-09, -1.219253959915618441e-10, 3.823656010012337921e-12, -1.226533026662600169e-13, 4.014864327293687959e-15, -1.328126469473931729e-16,
+        -2.453174667142169696e+00, 1.240327585060385304e-02, -1.886997308707030058e-04, 4.145784306299435259e-06, -1.042856855390509673e-07, 2.820628184882191789e-09, -7.982871481173709046e-11, 2.330563663386692189e-12, -6.959642257280086652e-14, 2.119989151033809825e-15, -6.528825017758641102e-17,
+        -2.429091331228383055e+00, 1.169510049738844287e-02, -1.661199396511917894e-04, 3.412742202511028469e-06, -8.028678699975830888e-08, 2.031063805546422803e-09, -5.376686148512374458e-11, 1.468272630743878624e-12, -4.101387485405809131e-14, 1.168256163050211229e-15, -3.365464747345697250e-17,
+        -2.866499311191330168e+00, 1.861913127788906303e-02, -4.968675956125305536e-04, 1.875490983982981658e-05, -8.081531482445773006e-07, 3.739454093720730450e-08, -1.809279428787917076e-09, 9.025914336005856004e-11, -4.604451112694760716e-12, 2.407672025543631072e-13, -1.266307311218295199e-14,
+        -2.831110318872911424e+00, 1.683353930908920021e-02, -4.011230990685155724e-04, 1.353939248944469620e-05, -5.218297726487372684e-07, 2.159928261781137685e-08, -9.348829741685078108e-10, 4.172360392058406832e-11, -1.904209895252905344e-12, 8.894403192243040222e-14, -4.185088490446005199e-15,
+        -2.798947130548349538e+00, 1.537638644189939265e-02, -3.308820973364688081e-04, 1.009951621447715588e-05, -3.520720841675518434e-07, 1.318210806788376301e-08, -5.161408391569781107e-10, 2.083887217577457233e-11, -8.603921113388372785e-13, 3.631670863209801449e-14, -1.545915833545046288e-15,
+        -2.769442331818898317e+00, 1.416374994093899664e-02, -2.777914227471260395e-04, 7.737942499064808359e-06, -2.462206727857708589e-07, 8.415585234472724743e-09, -3.008120555142612597e-10, 1.108774046244773054e-11, -4.179408952950404974e-13, 1.609218526030117935e-14, -6.253856229285633704e-16,
+        -2.742167782252166397e+00, 1.313818056266219565e-02, -2.366652426268565381e-04, 6.062208332295441178e-06, -1.774198889661768933e-07, 5.577898348321769064e-09, -1.834043601212257917e-10, 6.218685868143489070e-12, -2.156349629819605382e-13, 7.632954134843510859e-15, -2.728846538776456906e-16,
+        -2.716792255649619570e+00, 1.225900225533180753e-02, -2.041440304221674054e-04, 4.839753607139207084e-06, -1.311180532400515760e-07, 3.816211960245093245e-09, -1.161693988221313335e-10, 3.646808155278691884e-12, -1.170773864334280204e-13, 3.835046184863709846e-15, -1.269410309842891247e-16,
+        -2.693054091998041244e+00, 1.149659191375020789e-02, -1.779726686262118071e-04, 3.926721746142251487e-06, -9.902223773888293120e-08, 2.682860800963441480e-09, -7.602742254836860096e-11, 2.221854113315517911e-12, -6.640591753540739474e-14, 2.024249279707575414e-15, -6.237812384149419061e-17,
+        -2.670742888172718210e+00, 1.082885415193688729e-02, -1.565911068455260575e-04, 3.230829103800810209e-06, -7.620015034284907475e-08, 1.931038160056931590e-09, -5.118576196040146431e-11, 1.399236716637595515e-12, -3.911883739815522917e-14, 1.115085185208429496e-15, -3.214295455464386236e-17,
+        -3.079254202861287482e+00, 1.752338907696390433e-02, -4.727720080514670920e-04, 1.790367563821553191e-05, -7.729391504935571765e-07, 3.581201238362149364e-08, -1.734423915250242877e-09, 8.659295493936892909e-11, -4.420298940417534127e-12, 2.312670648592160460e-13, -1.216922137834599052e-14,
+        -3.045966605320794329e+00, 1.582497779250946132e-02, -3.814005898957385397e-04, 1.291677879698624228e-05, -4.988023969881829436e-07, 2.067385541938116329e-08, -8.957329056496230712e-10, 4.000854099724456167e-11, -1.827151493591648428e-12, 8.539335379421150116e-14, -4.019979033618245904e-15,
+        -3.015746289773752586e+00, 1.443991325954113725e-02, -3.144082804756159473e-04, 9.629529351165805155e-06, -3.363562036355124815e-07, 1.261094915440184567e-08, -4.942874271274668273e-10, 1.997296158009956630e-11, -8.252004535898433104e-13, 3.485151120419308953e-14, -1.484284579772784093e-15,
+        -2.988052067563376379e+00, 1.328799324001695217e-02, -2.638013187387554183e-04, 7.373904024343206758e-06, -2.351133707328417766e-07, 8.047184129374078543e-09, -2.879466081053251965e-10, 1.062242079357239098e-11, -4.006781365913688052e-13, 1.543662070076290525e-14, -6.002128873697910307e-16,
+        -2.962475816594318800e+00, 1.231434405564700747e-02, -2.246194631048228127e-04, 5.774117893865226280e-06, -1.693379592669553382e-07, 5.331389865023539751e-09, -1.754869260526589146e-10, 5.955302644546852801e-12, -2.066473914415524384e-13, 7.319205739080721497e-15, -2.618028641996614260e-16,
+        -2.938701962713464511e+00, 1.148013209290186555e-02, -1.936508099246055906e-04, 4.607592140564332751e-06, -1.250909710854658549e-07, 3.646063195850766412e-09, -1.111108319597433234e-10, 3.491031020549520014e-12, -1.121564491260469855e-13, 3.676091453941055089e-15, -1.217433521630760727e-16,
+        -2.916481332502941726e+00, 1.075708885659453808e-02, -1.687402613407446863e-04, 3.736701160763981071e-06, -9.443181141563371779e-08, 2.562251846055019826e-09, -7.268991879046056688e-11, 2.126186220194321053e-12, -6.359275434847129622e-14, 1.939693309633649412e-15, -5.980428012172874317e-17,
+        -2.895613655538102460e+00, 1.012413832246459450e-02, -1.483975601649544158e-04, 3.073192621419043171e-06, -7.263950826804710586e-08, 1.843551991973016510e-09, -4.892162563250572189e-11, 1.338536364412410668e-12, -3.744936352423489105e-14, 1.068165013658656090e-15, -3.080705429876863181e-17,
+        -3.280128635991337305e+00, 1.659510941021470273e-02, -4.516698694179419114e-04, 1.715253566985102692e-05, -7.417249901753065408e-07, 3.440482114671126333e-08, -1.667703224854088167e-09, 8.331894851940281380e-11, -4.255585752713728785e-12, 2.227581666196586386e-13, -1.172638124052582867e-14,
+        -3.248618740063815125e+00, 1.497299077332511601e-02, -3.641546529891850187e-04, 1.236816195962574832e-05, -4.784181510355900296e-07, 1.985202413019321477e-08, -8.608809524954459391e-10, 3.847880008834855486e-11, -1.758308906153258422e-12, 8.221684739050575776e-14, -3.872093149750131068e-15,
+        -3.220037501842019978e+00, 1.365091920544808483e-02, -3.000231223864480460e-04, 9.215941268498691836e-06, -3.224613924768863361e-07, 1.210432740703918181e-08, -4.748554198337859349e-10, 1.920147459499266257e-11, -7.937949211729392470e-13, 3.354211035840448798e-14, -1.429140056508069116e-15,
+        -3.193866828554730031e+00, 1.255198428023678384e-02, -2.516005473316118807e-04, 7.053936674709008265e-06, -2.253043037682878983e-07, 7.720766321344419701e-09, -2.765187371033620917e-10, 1.020826684581538606e-11, -3.852880129653037165e-13, 1.485133799752463653e-14, -5.777112845976326594e-16,
+        -3.169716204976665175e+00, 1.162358837314959870e-02, -2.141267021078702723e-04, 5.521187656025853010e-06, -1.622082067946463667e-07, 5.113195098834581277e-09, -1.684610703043186775e-10, 5.721103807424601623e-12, -1.986422249275538890e-13, 7.039349079336438268e-15, -2.519058500349271054e-16,
+        -3.147283807343320472e+00, 1.082852423968041697e-02, -1.845204298888241117e-04, 4.403978100820106050e-06, -1.197792304105111469e-07, 3.495600260945753361e-09, -1.066260191449851097e-10, 3.352638224353873719e-12, -1.077772145692257147e-13, 3.534428160136834295e-15, -1.171052498264735627e-16,
+        -3.126331419788011878e+00, 1.013971789697100043e-02, -1.607151302011271374e-04, 3.570209752262283268e-06, -9.038996987990053624e-08, 2.455692021634573130e-09, -6.973350852586699166e-11, 2.041265730158982300e-12, -6.109131222723718852e-14, 1.864395854010104638e-15, -5.750933850576808928e-17,
+        -3.106667654710633997e+00, 9.536991336626426258e-03, -1.412822414326347421e-04, 2.935203133533901498e-06, -6.950713130904464308e-08, 1.766321566650374421e-09, -4.691764869011587767e-11, 1.284697674059117636e-12, -3.596602491262934413e-14, 1.026413964488627943e-15, -2.961679566142183610e-17,
+        -3.470857711435349824e+00, 1.579613910521793924e-02, -4.330207556709930630e-04, 1.648414448984052963e-05, -7.138371414558841405e-07, 3.314405517552457925e-08, -1.607797857001294453e-09, 8.037436354943976251e-11, -4.107236103953115480e-12, 2.150852479143573652e-13, -1.132663200690064562e-14,
+        -3.440876097439728554e+00, 1.424139809785758548e-02, -3.489348059355595714e-04, 1.188060901902876356e-05, -4.602281187847555262e-07, 1.911655902619590020e-08, -8.296239466616498976e-10, 3.710447013601586895e-11, -1.696371211577458411e-12, 7.935540556408909149e-14, -3.738733772089482724e-15,
+        -3.413700796259489856e+00, 1.297488396985653838e-02, -2.873441920334149184e-04, 8.848818973540340094e-06, -3.100759542835798762e-07, 1.165142585270081302e-08, -4.574456077339005518e-10, 1.850905348474445233e-11, -7.655667465965874632e-13, 3.236370598310786486e-14, -1.379458713211245247e-15,
+        -3.388834229993898717e+00, 1.192262245932818564e-02, -2.408595736141677809e-04, 6.770224594952746106e-06, -2.165696984433708492e-07, 7.429245376029719029e-09, -2.662897628954425783e-10, 9.836898145917606356e-12, -3.714673145617011731e-13, 1.432507117248315709e-14, -5.574563914688563918e-16,
+        -3.365901504823996859e+00, 1.103404389847751320e-02, -2.048994640602060384e-04, 5.297142478335330815e-06, -1.558654487900342311e-07, 4.918504010877327403e-09, -1.621778079035335286e-10, 5.511278385525384771e-12, -1.914593727205096404e-13, 6.787916495870131628e-15, -2.430041532163746915e-16,
+        -3.344612983918223481e+00, 1.027338868724012727e-02, -1.764994332113861079e-04, 4.223786811656936543e-06, -1.150579972085522562e-07, 3.361458895963345533e-09, -1.026185124060964093e-10, 3.228746925449398777e-12, -1.038508831235300067e-13, 3.407250157172994148e-15, -1.129367118039366905e-16,
+        -3.324740153522625086e+00, 9.614645101609867878e-03, -1.536718179285937239e-04, 3.423000908689964237e-06, -8.680045277225610594e-08, 2.360767072019264387e-09, -6.709377496840683093e-11, 1.965300536719941645e-12, -5.885020934175071581e-14, 1.796846098123882788e-15, -5.544818842633106030e-17,
+        -3.306099483903192304e+00, 9.038433029729916676e-03, -1.350430415919680164e-04, 2.813296928562813688e-06, -6.672748642358344411e-08, 1.697575399852708318e-09, -4.512962860551488648e-11, 1.236570564291674593e-12, -3.463798203794280387e-14, 9.889841853605342681e-16, -2.854850089077194303e-17,
+        -3.652796885321562215e+00, 1.509938908982846363e-02, -4.164034134780629092e-04, 1.588490943520976578e-05, -6.887446387273149000e-07, 3.200682010437938589e-08, -1.553659273347981935e-09, 7.770918381915045544e-11, -3.972793100678990328e-12, 2.081240124454799873e-13, -1.096362096349941802e-14,
+        -3.624146727624928843e+00, 1.360464793585878032e-02, -3.353902178183781066e-04, 1.144400284324113278e-05, -4.438790436966169929e-07, 1.845384137884367469e-08, -8.014041314487679000e-10, 3.586175691873071241e-11, -1.640293025286855372e-12, 7.676179335976626828e-14, -3.617741574190011826e-15,
+        -3.598193999227240703e+00, 1.238754795271348498e-02, -2.760738530822208557e-04, 8.520404203793596057e-06, -2.989550101912207343e-07, 1.124370854850982606e-08, -4.417418543282157692e-10, 1.788350110411825329e-11, -7.400312595707834608e-13, 3.129651127551233436e-14, -1.334422388222439667e-15,
+        -3.574459485139132475e+00, 1.137675283236218825e-02, -2.313220481472783247e-04, 6.516671641043558402e-06, -2.087340092609845635e-07, 7.167037539083666996e-09, -2.570709555189467881e-10, 9.501668801182000662e-12, -3.589749980005117933e-13, 1.384884489789455739e-14, -5.391094478937990668e-16,
+        -3.552582260014483406e+00, 1.052351313497216015e-02, -1.967141687718474503e-04, 5.097094094220601940e-06, -1.501802763904682465e-07, 4.743531697747937690e-09, -1.565194938661899373e-10, 5.322016388334852541e-12, -1.849717403348679537e-13, 6.560557945762380254e-15, -2.349467586326672384e-16,
+        -3.532283574138537219e+00, 9.793367459776616823e-03, -1.693907403974699534e-04, 4.063030777415798356e-06, -1.108295930668823698e-07, 3.240995169255273234e-09, -9.901224843183767265e-11, 3.117076975566945222e-12, -1.003070463774687243e-13, 3.292327692289056244e-15, -1.091660799897312105e-16,
+        -3.513343573457897495e+00, 9.161255890582774286e-03, -1.474350203952835663e-04, 3.291773812893608171e-06, -8.358802487716776049e-08, 2.275581867436087073e-09, -6.471997561467145306e-11, 1.896874858557741367e-12, -5.682875324158220858e-14, 1.735844957757490821e-15, -5.358495944922382464e-17,
+        -3.495585736070579319e+00, 8.608512693616194450e-03, -1.295227960886357927e-04, 2.704706658845099943e-06, -6.424160037136656619e-08, 1.635924424391498062e-09, -4.352278413114687528e-11, 1.193247455441302851e-12, -3.344083791313415351e-14, 9.552034991707184354e-16, -2.758336272484896963e-17,
+        -3.827028112350253863e+00, 1.448504370487504675e-02, -4.014868049986941665e-04, 1.534405906091132731e-05, -6.660241492969507923e-07, 3.097478211592894041e-08, -1.504444941167817012e-09, 7.528310859205526818e-11, -3.850272500236850466e-12, 2.017738732915770621e-13, -1.063219822066713475e-14,
+        -3.799550972422371498e+00, 1.304413174765607988e-02, -3.232456079149896686e-04, 1.105034062018764349e-05, -4.290897848918149937e-07, 1.785298467079603233e-08, -7.757741173940729977e-10, 3.473152131669671999e-11, -1.589231513931162561e-12, 7.439785062747509691e-14, -3.507369013641272105e-15,
+        -3.774673628350912580e+00, 1.187131590718684855e-02, -2.659788693575788660e-04, 8.224570007888868897e-06, -2.889039887582584551e-07, 1.087436301378928961e-08, -4.274909818653401662e-10, 1.731502194646910381e-11, -7.167983043867271691e-13, 3.032456547009894570e-14, -1.293369951823796281e-15,
+        -3.751933415250459536e+00, 1.089764529966682702e-02, -2.227873169348582472e-04, 6.288470579658752046e-06, -2.016579609453173619e-07, 6.929692994575732950e-09, -2.487113901121303300e-10, 9.197249167971857241e-12, -3.476173008340165590e-13, 1.341542953937082706e-14, -5.223970947604811205e-16,
+        -3.730981985754346475e+00, 1.007601503974257795e-02, -1.893959860679624160e-04, 4.917192955584680664e-06, -1.450501580504013283e-07, 4.585265961694272299e-09, -1.513921748763447205e-10, 5.150266454785558918e-12, -1.790772968437501877e-13, 6.353774018370896490e-15, -2.276119630107523875e-16,
+        -3.711550385222187831e+00, 9.373135697323772830e-03, -1.630403781132234412e-04, 3.918573704004609089e-06, -1.070167239229614694e-07, 3.132107551951667615e-09, -9.574655706108089232e-11, 3.015804482119946916e-12, -9.708924947794244463e-14, 3.187869195054992300e-15, -1.057356740688821271e-16,
+        -3.693426544555586943e+00, 8.764805977903139186e-03, -1.418678816679767472e-04, 3.173935240343973035e-06, -8.069322117481498843e-08, 2.198631817927346492e-09, -6.257168363061410903e-11, 1.834857507719478375e-12, -5.499435293803382079e-14, 1.680430072773948476e-15, -5.189081033864880939e-17,
+        -3.676440237162846181e+00, 8.233004137137117998e-03, -1.245988925467461086e-04, 2.607260524888878449e-06, -6.200291217110512987e-08, 1.580267026465929943e-09, -4.206943482828512434e-11, 1.154003982962966857e-12, -3.235507353123116175e-14, 9.245330000252523343e-16, -2.670627522052432738e-17,
+        -3.994430816038389676e+00, 1.393824016203358725e-02, -3.880081023061946193e-04, 1.485296184721164231e-05, -6.453344297285926954e-07, 3.003310042509307370e-08, -1.459470649566147416e-09, 7.306332482041321250e-11, -3.738055203108594001e-12, 1.959525985679110503e-13, -1.032814678072202170e-14,
+        -3.967996993641163428e+00, 1.254594432907964012e-02, -3.122827901094759359e-04, 1.069322076319579208e-05, -4.156341093404311703e-07, 1.730519141140895137e-08, -7.523711868294426495e-10, 3.369820556658657749e-11, -1.542500048219576297e-12, 7.223243025738701474e-14, -3.406187360113259046e-15,
+        -3.944074830956589839e+00, 1.141308515349830598e-02, -2.568746607703742153e-04, 7.956423169471197910e-06, -2.797665641972629617e-07, 1.053789246356673093e-08, -4.144880373348909526e-10, 1.679566525631238948e-11, -6.955504978068902316e-13, 2.943485988048317695e-14, -1.255761659130645517e-15,
+        -3.922216671501405294e+00, 1.047288138199307939e-02, -2.150968027493385074e-04, 6.081787775917307210e-06, -1.952298149616750405e-07, 6.713626362642145183e-09, -2.410890582016798200e-10, 8.919319189355689171e-12, -3.372368125920458178e-13, 1.301894045247466693e-14, -5.070964546213196915e-16,
+        -3.902085564855400257e+00, 9.679722749273138305e-03, -1.828069189994736452e-04, 4.754373276395506577e-06, -1.403929428183005904e-07, 4.441282909707237339e-09, -1.467199953153968998e-10, 4.993558341463940603e-12, -1.736932560219878475e-13, 6.164719815092529192e-15, -2.209006583380897504e-16,
+        -3.883421425005105121e+00, 9.001384183185209484e-03, -1.573269497326909875e-04, 3.787920945334194560e-06, -1.035575356055921884e-07, 3.033106994272802400e-09, -9.277251265505175476e-11, 2.923454626093222448e-12, -9.415173858216894549e-14, 3.092419839114433323e-15, -1.025985754507845836e-16,
+        -3.866019226517108720e+00, 8.414443650611561770e-03, -1.368626127942484960e-04, 3.067424893383348519e-06, -7.806850943841246265e-08, 2.128709006208961478e-09, -6.061633404051910298e-11, 1.778334790102061097e-12, -5.332062346407892681e-14, 1.629820799933965025e-15, -5.034230561222755883e-17,
+        -3.849714434910062710e+00, 7.901463509837449231e-03, -1.201748524142253648e-04, 2.519234912312749940e-06, -5.997424400696465223e-08, 1.529719738176401392e-09, -4.074730643456791407e-11, 1.118255654451920223e-12, -3.136490267712225990e-14, 8.965359772286096662e-16, -2.590497589515380809e-17,
+        -4.155730915121552016e+00, 1.344759016943610462e-02, -3.757563715339536526e-04, 1.440462638454361400e-05, -6.263975262516481645e-07, 2.916963907477301451e-08, -1.418175202165842233e-09, 7.102285352232334295e-11, -3.634807280474961436e-12, 1.905923207314561005e-13, -1.004798100682706679e-14,
+        -4.130232694704751850e+00, 1.209946524734676482e-02, -3.023269603064100263e-04, 1.036746681223379861e-05, -4.033280429886914160e-07, 1.680327890983462448e-08, -7.308982964161173716e-10, 3.274903749593626213e-11, -1.499533781529900405e-12, 7.023986401298594887e-14, -3.313017397133776470e-15,
+        -4.107166090797335301e+00, 1.100287772211632278e-02, -2.486135776091882485e-04, 7.712012978732107820e-06, -2.714157995288395004e-07, 1.022981552692098548e-08, -4.025654135453755783e-10, 1.631891288314883574e-11, -6.760271044303000358e-13, 2.861668852722180568e-14, -1.221152618972851682e-15,
+        -4.086097132693386591e+00, 1.009303003311600236e-02, -2.081238358920544393e-04, 5.893532344023090118e-06, -1.893589623859173060e-07, 6.515918449852194298e-09, -2.341043123695139931e-10, 8.664341717131696860e-12, -3.277043798270506917e-13, 1.265454063796080384e-14, -4.930240423605701507e-16,
+        -4.066699254897518934e+00, 9.325677489123771965e-03, -1.768368803542151851e-04, 4.606166445368867794e-06, -1.361420978478183952e-07, 4.309611434421326625e-09, -1.424410760804830213e-10, 4.849871854979817190e-12, -1.687517713264331198e-13, 5.991059588377102536e-15, -2.147313455027375493e-16,
+        -4.048720447010916601e+00, 8.669566850836843766e-03, -1.521537270065631911e-04, 3.669066188144178462e-06, -1.004019916676080046e-07, 2.942621522969304672e-09, -9.005024860975460161e-11, 2.838822602180295524e-12, -9.145705700023110676e-14, 3.004786438502511567e-15, -9.971624228705627497e-17,
+        -4.031962093377562617e+00, 8.101987177980949154e-03, -1.323334234670757990e-04, 2.970587636630571587e-06, -7.567548068068743080e-08, 2.064833313002352798e-09, -5.882741918676116989e-11, 1.726561056364619717e-12, -5.178598634507898890e-14, 1.583377526219293940e-15, -4.892021282966786307e-17,
+        -4.016264836303850672e+00, 7.606033536047797187e-03, -1.161739668934904036e-04, 2.439246612033945666e-06, -5.812558457652338710e-08, 1.483566417484227208e-09, -3.953828558284470609e-11, 1.085525934467507606e-12, -3.045742709625599960e-14, 8.708549503270283396e-16, -2.516941078008253120e-17,
+        -4.311535642478927066e+00, 1.300420567509319794e-02, -3.645605278548953655e-04, 1.399333200916004253e-05, -6.089848144915359559e-07, 2.837437933150057295e-08, -1.380094011396105940e-09, 6.913930975602119997e-11, -3.539419866637562876e-12, 1.856365310859951075e-13, -9.788794576013468753e-15,
+        -4.286882442657784509e+00, 1.169642873648439607e-02, -2.932365739586977309e-04, 1.006884987173773374e-05, -3.920204923679082548e-07, 1.634132631088175981e-08, -7.111098927479863953e-10, 3.187343478869812887e-11, -1.459863822203613540e-12, 6.839880906758116846e-14, -3.226877228106906778e-15,
+        -4.264587771860221643e+00, 1.063294768267315608e-02, -2.410762435514689846e-04, 7.488116555513798702e-06, -2.637475886634262224e-07, 9.946443069887824031e-09, -3.915847383859080752e-10, 1.587937119784531396e-11, -6.580119560090791620e-13, 2.786116064935927296e-14, -1.189172841659084959e-15,
+        -4.244230201396099744e+00, 9.750787214014093249e-03, -2.017661439707580100e-04, 5.721186151134860153e-06, -1.839711855669087319e-07, 6.334169094579051981e-09, -2.276749854399862626e-10, 8.429393296642795979e-12, -3.189130496021517677e-13, 1.231821783025948043e-14, -4.800274371937635065e-16,
+        -4.225492676468349806e+00, 9.006956289767192869e-03, -1.713970993958944004e-04, 4.470563746297684237e-06, -1.322431901506412919e-07, 4.188632739456140374e-09, -1.385044498335675481e-10, 4.717539130316757116e-12, -1.641967189631050268e-13, 5.830857905450013426e-15, -2.090363943079131476e-16,
+        -4.208130577930919713e+00, 8.371093330545859371e-03, -1.474428034040285685e-04, 3.560378740192775591e-06, -9.750920015168680650e-08, 2.859525584155765433e-09, -8.754696247121897298e-11, 2.760914739640244718e-12, -8.897425096291959626e-14, 2.923981280177858554e-15, -9.705672271148006676e-17,
+        -4.191951153366891170e+00, 7.821139472475641466e-03, -1.282112926903216418e-04, 2.882079633906109712e-06, -7.348277747902641587e-08, 2.006201456365716476e-09, -5.718314960414777330e-11, 1.678921913410168247e-12, -5.037262609706679561e-14, 1.540571273167100493e-15, -4.760860252529445881e-17,
+        -4.176799777938597025e+00, 7.340678029283297795e-03, -1.125345848436310473e-04, 2.366173687543672596e-06, -5.643245591838149185e-08, 1.441220679688595494e-09, -3.842749655810504605e-11, 1.055422523514464807e-12, -2.962200719767161947e-14, 8.471945297736178640e-16, -2.449125972397543639e-17,
+        -4.462358870048820592e+00, 1.260103788536860031e-02, -3.542804053618717848e-04, 1.361435327275676332e-05, -5.929065275074413795e-07, 2.763897706122561879e-08, -1.344839142059699552e-09, 6.739396290529052703e-11, -3.450963503399183284e-12, 1.810377923041824151e-13, -9.548144553416074337e-15,
+        -4.438473681373895197e+00, 1.133029543306311726e-02, -2.848958489825018829e-04, 9.793881888899154162e-06, -3.815862213044309146e-07, 1.591440916574429107e-08, -6.928012104412747378e-10, 3.106255428929680472e-11, -1.423097648795055454e-12, 6.669137158460297197e-14, -3.146942548684909853e-15,
+        -4.416879959663564392e+00, 1.029718059276063524e-02, -2.341651492870324889e-04, 7.282079187609524179e-06, -2.566757526004161700e-07, 9.684710619751121640e-09, -3.814307646994307836e-10, 1.547253837021063566e-11, -6.413243047751670577e-13, 2.716083086601424385e-14, -1.159512075277770746e-15,
+        -4.397167821925491715e+00, 9.440399195823722181e-03, -1.959402978832601569e-04, 5.562677544960085565e-06, -1.790051196984489311e-07, 6.166386825103151143e-09, -2.217327186520178267e-10, 8.212036520603572432e-12, -3.107734902538122857e-13, 1.200661561722655226e-14, -4.679789621240595134e-16,
+        -4.379028963276181408e+00, 8.718116095394365730e-03, -1.664152485842920379e-04, 4.345914502793971053e-06, -1.286512624927632724e-07, 4.077005094018075334e-09, -1.348677583047189461e-10, 4.595171008677060678e-12, -1.599812686978808473e-13, 5.682497297410024531e-15, -2.037592086036042791e-16,
+        -4.362225560801347157e+00, 8.100791407395419030e-03, -1.431307744984864694e-04, 3.460519989167015554e-06, -9.484542196911878889e-08, 2.782887188980574948e-09, -8.523541882380126873e-11, 2.688904195395156600e-12, -8.667751633683510766e-14, 2.849179674767072195e-15, -9.459330208119072235e-17,
+        -4.346570250530709778e+00, 7.566966883512607316e-03, -1.244401065086465962e-04, 2.800798842881431982e-06, -7.146455211534545389e-08, 1.952148911570025229e-09, -5.566545012105976043e-11, 1.634906570807410821e-12, -4.906570402941091475e-14, 1.500960749981881345e-15, -4.639416750704765452e-17,
+        -4.331912755128204395e+00, 7.100675347495179202e-03, -1.092066333605290463e-04, 2.299096927665786224e-06, -5.487469906577458993e-08, 1.402197852181628599e-09, -3.740260986547223303e-11, 1.027619545182090925e-12, -2.884978840820987586e-14, 8.253084909132550697e-16, -2.386357775500926324e-17,
+        -4.608639913971760649e+00, 1.223241735082715442e-02, -3.448000827147270275e-04, 1.326375229121875029e-05, -5.780038177103094318e-07, 2.695642579039950363e-08, -1.312084070050797592e-09, 6.577101707450382988e-11, -3.368653099687167362e-12, 1.767559793575307144e-13, -9.323962093821666405e-15,
+        -4.585456631373778791e+00, 1.099581689734153642e-02, -2.772091705229965427e-04, 9.539660119726936567e-06, -3.719205360138483500e-07, 1.551839771852338280e-08, -6.758001124250889910e-10, 3.030894744508745326e-11, -1.388904103636358283e-12, 6.510243385542331498e-14, -3.072516094107287521e-15,
+        -4.564503010816986617e+00, 9.990678688970433888e-03, -2.277998773158770288e-04, 7.091694383841123054e-06, -2.501283340853737962e-07, 9.442051208464834564e-09, -3.720067186143952974e-10, 1.509462671884358955e-11, -6.258118254061412172e-13, 2.650941565748138480e-14, -1.131908161178401626e-15,
+        -4.545379841325014603e+00, 9.157265521543616824e-03, -1.905775765326990110e-04, 5.416286619276947567e-06, -1.744095828468509448e-07, 6.010905247567594773e-09, -2.162201701186362972e-10, 8.010222722673998944e-12, -3.032104926178711159e-13, 1.171690415130091208e-14, -4.567708367927275980e-16,
+        -4.527786901384318163e+00, 8.454812209190041075e-03, -1.618318186967173560e-04, 4.230849756907659197e-06, -1.253288558386926111e-07, 3.973606887529054649e-09, -1.314955038547724434e-10, 4.481600984779387590e-12, -1.560660301486529296e-13, 5.544615292689379684e-15, -1.988520549502029006e-16,
+        -4.511492643428321792e+00, 7.854539109256307786e-03, -1.391655277265669405e-04, 3.368380875308189961e-06, -9.238257173698590366e-08, 2.711927960457390939e-09, -8.309281385947389487e-11, 2.622097259877790546e-12, -8.454516713046813618e-14, 2.779687536722435249e-15, -9.230346803356243756e-17,
+        -4.496314676615789985e+00, 7.335543421049368039e-03, -1.209737898955501545e-04, 2.725833047369618006e-06, -6.959930721598544935e-08, 1.902121157153705676e-09, -5.425919931400911962e-11, 1.594086833755087318e-12, -4.785275963852712830e-14, 1.464174847069040358e-15, -4.526570263463173885e-17,
+        -4.482106734270024262e+00, 6.882273500430402362e-03, -1.061490357774171376e-04, 2.237256114479908535e-06, -5.343556186878067554e-08, 1.366093819189600237e-09, -3.645331893767702413e-11, 1.001844028280845900e-12, -2.813334090430139065e-14, 8.049899224612033330e-16, -2.328052126781833205e-17,
+        -4.750757754603033511e+00, 1.189372678516187505e-02, -3.360228462574275259e-04, 1.293822060420545107e-05, -5.641426764905527130e-07, 2.632079755595222168e-08, -1.281551922568470514e-09, 6.425705442894984685e-11, -3.291820767015015567e-12, 1.727569132577791271e-13, -9.114482971329307150e-15,
+        -4.728219145227797071e+00, 1.068872685791326209e-02, -2.700968752256509026e-04, 9.303748877756011339e-06, -3.629352207564761431e-07, 1.514980201574804292e-08, -6.599608042803002709e-10, 2.960629419502108504e-11, -1.357001777712144675e-12, 6.361913251275591828e-14, -3.003003907591009475e-15,
+        -4.707853009957373658e+00, 9.709467694206656840e-03, -2.219135092257858209e-04, 6.915112816933555653e-06, -2.440447683485275265e-07, 9.216297876799304625e-09, -3.632307214662605584e-10, 1.474242570541462105e-11, -6.113452062383432102e-13, 2.590157381685122329e-14, -1.106138001926609182e-15,
+        -4.689270039002159329e+00, 8.897659174918920097e-03, -1.856208595698377812e-04, 5.280573395477298880e-06, -1.701415400415598185e-07, 5.866319023932251859e-09, -2.110888704320900183e-10, 7.822217032893627534e-12, -2.961602693661628456e-13, 1.144668016245719368e-14, -4.463114226528944459e-16,
+        -4.672177506624710652e+00, 8.213530089834159345e-03, -1.575973982722746051e-04, 4.124224482552956575e-06, -1.222445033153587746e-07, 3.877493080502987113e-09, -1.283577080186293013e-10, 4.375842088121269646e-12, -1.524176236565260940e-13, 5.416055779527004390e-15, -1.942743826024095028e-16,
+        -4.656349681765769688e+00, 7.629006737021217302e-03, -1.355038355955734809e-04, 3.283034603972367571e-06, -9.009707739375408251e-08, 2.645992614314941472e-09, -8.109990523170870859e-11, 2.559907466945598084e-12, -8.255884114694541627e-14, 2.714916369962948199e-15, -9.016811060922423770e-17,
+        -4.641608781121312255e+00, 7.123701879746238176e-03, -1.177741585650031019e-04, 2.656420598220644101e-06, -6.786901480045788272e-08, 1.855651734080023653e-09, -5.295164727641431456e-11, 1.556100978572415715e-12, -4.672325010587527241e-14, 1.429899142478111851e-15, -4.421370316929865068e-17,
+        -4.627812252355672840e+00, 6.682449421978299553e-03, -1.033277795139094847e-04, 2.180017019078839598e-06, -5.210100656608235557e-08, 1.332568895319947898e-09, -3.557093992951467933e-11, 9.778655410713795590e-13, -2.746638273210014172e-14, 7.860636405674951290e-16, -2.273713682325480302e-17,
+        -4.889041963697292381e+00, 1.158116370302145030e-02, -3.278673498705923740e-04, 1.263495749275751989e-05, -5.512092294101653612e-07, 2.572704159013644299e-08, -1.253006315040668565e-09, 6.284060038752442047e-11, -3.219894557598471137e-12, 1.690112897649014630e-13, -8.918193023143792259e-15,
+        -4.867098095008418390e+00, 1.040551788596829653e-02, -2.634920424322442865e-04, 9.084088693219223503e-06, -3.545553979934500550e-07, 1.480565177165459353e-08, -6.451589440925737981e-10, 2.894919542649818975e-11, -1.327149933105357446e-12, 6.223045000601658347e-14, -2.937896731101593442e-15,
+        -4.847273591697626394e+00, 9.450285328791814196e-03, -2.164498951390834763e-04, 6.750772476582929259e-06, -2.383737005656814623e-07, 9.005608162940497582e-09, -3.550330100032926764e-10, 1.441319523000269029e-11, -5.978139279178402290e-13, 2.533273479098587978e-14, -1.082010488303141571e-15,
+        -4.829188361258894169e+00, 8.658525239887185018e-03, -1.810222689790912001e-04, 5.154322807246574016e-06, -1.661645348172803952e-07, 5.731434350763608131e-09, -2.062975588255295344e-10, 7.646540082123569064e-12, -2.895683498783553298e-13, 1.119388887795524212e-14, -4.365222861762799366e-16,
+        -4.812556652792353340e+00, 7.991392830944191866e-03, -1.536706112449268905e-04, 4.025073373966241489e-06, -1.193715713796181150e-07, 3.787861559530440284e-09, -1.254288718962257671e-10, 4.277053382214087455e-12, -1.490075675851690963e-13, 5.295831068188370396e-15, -1.899915109940099089e-16,
+        -4.797158145237633065e+00, 7.421472097553021355e-03, -1.321095332365938152e-04, 3.203700508333587903e-06, -8.796900371103705235e-08, 2.584525406818148436e-09, -7.924033844379371143e-11, 2.501835500547422311e-12, -8.070288217791804579e-14, 2.654363777127438857e-15, -8.817089800457509198e-17,
+        -4.782819339141187953e+00, 6.928855954338963147e-03, -1.148092940476071910e-04, 2.591920443380288415e-06, -6.625843990327437433e-08, 1.812345331132725758e-09, -5.173196535287815948e-11, 1.520641251080460838e-12, -4.566819249891848097e-14, 1.397865398379793507e-15, -4.323005162216512352e-17,
+        -4.769401134312363233e+00, 6.498737245971404793e-03, -1.007144559916413627e-04, 2.126846231699524492e-06, -5.085917867503373173e-08, 1.301335405445250933e-09, -3.474810251726747563e-11, 9.554881621069875789e-13, -2.684356488002136019e-14, 7.683802893338107334e-16, -2.222919663515725346e-17,
+        -5.023781222477203379e+00, 1.129156518613377500e-02, -3.202646572077064505e-04, 1.235157541285841939e-05, -5.391060602751033999e-07, 2.517082643972323973e-08, -1.226244144327904642e-09, 6.151178085000854478e-11, -3.152381670315364485e-12, 1.654938317804108370e-13, -8.733784921741255433e-15,
+        -5.002388229697918298e+00, 1.014327696391926353e-02, -2.573380266979705166e-04, 8.878925826077584940e-06, -3.467170789248743871e-07, 1.448340229340446935e-08, -6.312878019686635126e-10, 2.833300959867007414e-11, -1.299141343172319783e-12, 6.092689183370689995e-14, -2.876755280907341395e-15,
+        -4.983065117554658308e+00, 9.210425974708644908e-03, -2.113615570670276500e-04, 6.597344549480521002e-06, -2.330712855642649585e-07, 8.808405051216820172e-09, -3.473537561743124600e-10, 1.410458174392843641e-11, -5.851229381661772716e-13, 2.479896323001932194e-14, -1.059360909944524298e-15,
+        -4.965440400912113361e+00, 8.437333352032349437e-03, -1.767413605975459441e-04, 5.036502128056025371e-06, -1.624474688618282064e-07, 5.605230280723820771e-09, -2.018108798018788078e-10, 7.481922227300525157e-12, -2.833879239600960704e-13, 1.095676248418358076e-14, -4.273358807863988312e-16,
+        -4.949234839451118084e+00, 7.786020371771235592e-03, -1.500165374186342203e-04, 3.932576674451082451e-06, -1.166873592303468346e-07, 3.704026888885810131e-09, -1.226871626877077201e-10, 4.184513688307052433e-12, -1.458114038235022163e-13, 5.183092023114888290e-15, -1.859735948573458069e-16,
+        -4.934233160063960177e+00, 7.229685649289442108e-03, -1.289521242139147561e-04, 3.129716149757545084e-06, -8.598137186721816913e-08, 2.527051779863790592e-09, -7.750012031658824015e-11, 2.447453450762740910e-12, -7.896385494897188756e-14, 2.597598130254001957e-15, -8.629778486160069864e-17,
+        -4.920265859035036549e+00, 6.748870647609968819e-03, -1.120523019193354837e-04, 2.531789013701141165e-06, -6.475461602538999442e-08, 1.771864615921940669e-09, -5.059089452940078353e-11, 1.487444080476727193e-12, -4.467988312110804114e-14, 1.367843307896670179e-15, -4.230777131923624291e-17,
+        -4.907197055067777036e+00, 6.329103419666905379e-03, -9.828514593421992047e-05, 2.077291768402231590e-06, -4.969999549242804681e-08, 1.272148023907837235e-09, -3.397850866649158268e-11, 9.345442007657711111e-13, -2.626030284435824098e-14, 7.518117093705857028e-16, -2.175306921970335186e-17,
+        -5.155230047625109613e+00, 1.102227647463816483e-02, -3.131559408659150370e-04, 1.208602580024199602e-05, -5.277493124791015185e-07, 2.464841502750720970e-08, -1.201089870162093357e-09, 6.026204961219118280e-11, -3.088855071006880318e-12, 1.621826129896855106e-13, -8.560123633323267552e-15,
+        -5.134349155344904325e+00, 9.899562473458214246e-03, -2.515865413502104135e-04, 8.686757045685089909e-06, -3.393652347557696175e-07, 1.418086014037380373e-08, -6.182552168518006325e-10, 2.775372299683241678e-11, -1.272796596040298368e-12, 5.970022933109641126e-14, -2.819198497442006902e-15,
+        -5.115491894877151502e+00, 8.987624723081507477e-03, -2.066080627959072252e-04, 6.453691078465384221e-06, -2.280998507484343380e-07, 8.623330367801291514e-09, -3.401413417097776207e-10, 1.381455171328231467e-11, -5.731900093912099022e-13, 2.429685117814086642e-14, -1.038046500372595783e-15,
+        -5.098294841940687938e+00, 8.231967781793575814e-03, -1.727437233110148116e-04, 4.926227705768346518e-06, -1.589636435099240998e-07, 5.486828232640773215e-09, -1.975983528352038250e-10, 7.327267285660358585e-12, -2.775785271573809651e-13, 1.073377120091099852e-14, -4.186937012851525094e-16,
+        -5.082484851062874398e+00, 7.595424812855717557e-03, -1.466054904657675920e-04, 3.846033506094635069e-06, -1.141723922400751214e-07, 3.625399641566491443e-09, -1.201137713436985318e-10, 4.097600789400898084e-12, -1.428080043652415189e-13, 5.077104340896566858e-15, -1.821948011189754117e-16,
+        -5.067851373073392729e+00, 7.051770406933041691e-03, -1.260057030996825306e-04, 3.060515565563634137e-06, -8.411962615937623183e-08, 2.473163922191843600e-09, -7.586720362506157584e-11, 2.396392365598902313e-12, -7.733016087206261384e-14, 2.544246407318625231e-15, -8.453662154895208404e-17,
+        -5.054228642287514894e+00, 6.581966239737510951e-03, -1.094803531538509727e-04, 2.475562219573701685e-06, -6.334643441151000953e-08, 1.733919885301961403e-09, -4.952046831640669725e-11, 1.456282348823677956e-12, -4.375167538793613738e-14, 1.339633952226717200e-15, -4.144083075353928209e-17,
+        -5.041483787773874958e+00, 6.171854304011205154e-03, -9.601955964869494378e-05, 2.030967979875251541e-06, -4.861482418029771166e-08, 1.244796188746498015e-09, -3.325674267252093107e-11, 9.148892410443268706e-13, -2.571264343216465703e-14, 7.362472691854419320e-16, -2.130561678713094865e-17,
+        -5.283614164154163184e+00, 1.077105102197037888e-02, -3.064906755144372759e-04, 1.183654033081631917e-05, -5.170663832410649603e-07, 2.415656493723128799e-08, -1.177390939426650982e-09, 5.908396980658421733e-11, -3.028942746089891585e-12, 1.590585138070814865e-13, -8.396218597048983414e-15,
+        -5.263210901034142353e+00, 9.672310839650781131e-03, -2.461961557249558920e-04, 8.506285975155666691e-06, -3.324522645613055957e-07, 1.389612387087623352e-08, -6.059811646924638946e-10, 2.720784583586773339e-11, -1.247959525063601823e-12, 5.854329303169460360e-14, -2.764894093185505829e-15,
+        -5.244787923842618049e+00, 8.779969550169896067e-03, -2.021547525051334445e-04, 6.318831531960551130e-06, -2.234268352789063930e-07, 8.449207679674311313e-09, -3.333509809640141879e-10, 1.354133840066474425e-11, -5.619436214940543456e-13, 2.382343156102951119e-14, -1.017942857349470557e-15,
+        -5.227989377288597694e+00, 8.040644334040359179e-03, -1.689998834657200678e-04, 4.822738728516717510e-06, -1.556900001387635710e-07, 5.375467745798510153e-09, -1.936335509233439537e-10, 7.181623559120296209e-12, -2.721049884880901357e-13, 1.052358406141466798e-14, -4.105448024385803099e-16,
+        -5.212547836807561730e+00, 7.417931405659737576e-03, -1.434120632732716744e-04, 3.764840859555062835e-06, -1.118098625952934143e-07, 3.551469980076167053e-09, -1.176924009401881913e-10, 4.015774831103828668e-12, -1.399790168397481142e-13, 4.977229552581750743e-15, -1.786326488377397200e-16,
+        -5.198257185884979314e+00, 6.886146514253659728e-03, -1.232481146576971107e-04, 2.995612150386758617e-06, -8.237121223340682891e-08, 2.422509310263410878e-09, -7.433115657419110434e-11, 2.348332324091509392e-12, -7.579173107411875368e-14, 2.493984459918785917e-15, -8.287684111587597513e-17,
+        -5.184955165311812664e+00, 6.426646031578493561e-03, -1.070739367392189989e-04, 2.422841295909432059e-06, -6.202431951104023504e-08, 1.698260858882936621e-09, -4.851379242610201461e-11, 1.426959231594887434e-12, -4.287780252476367289e-14, 1.313064569899660095e-15, -4.062398696112524955e-17,
+        -5.172511727242587121e+00, 6.025566746364128048e-03, -9.390036739092113074e-05, 1.987543696565028292e-06, -4.759622761758248948e-08, 1.219098091730337381e-09, -3.257812025624455878e-11, 8.963981957747789685e-13, -2.519715852618261498e-14, 7.215909345972510942e-16, -2.088411316367879505e-17,
+        -5.409134842723289260e+00, 1.053597350082348047e-02, -3.002252060917940139e-04, 1.160158401933490811e-05, -5.069940743114207395e-07, 2.369244818832574385e-08, -1.155014095946303583e-09, 5.797103729779068034e-11, -2.972319004961076136e-12, 1.561047804244518572e-13, -8.241201149146277053e-15,
+        -5.389178404810358813e+00, 9.459764754688966548e-03, -2.411311060262153741e-04, 8.336388280440634347e-06, -3.259367680480628673e-07, 1.362753643006797469e-08, -5.943957996495745908e-10, 2.669232840938817391e-11, -1.224493514881248383e-12, 5.744980538706207633e-14, -2.713550891488416764e-15,
+        -5.371161522437399860e+00, 8.585833915757177734e-03, -1.979717324277229830e-04, 6.191916178756690941e-06, -2.190239413497559851e-07, 8.285012516612147560e-09, -3.269436128771194207e-10, 1.328339896206258820e-11, -5.513212522239334723e-13, 2.337610822661484861e-14, -9.989410445751540553e-16,
+        -5.354735464823098923e+00, 7.861846677288763727e-03, -1.654844400530875597e-04, 4.725376354142903022e-06, -1.526065130872940954e-07, 5.270487040189354993e-09, -1.898934403422817523e-10, 7.044160498475963375e-12, -2.669365815748664180e-13, 1.032503722819568494e-14, -4.028446007018083929e-16,
+        -5.339638190581499799e+00, 7.252118108585899926e-03, -1.404143751919074371e-04, 3.688476896494785794e-06, -1.095851826947278174e-07, 3.481794504510051346e-09, -1.154088558444191698e-10, 3.938564965796194954e-12, -1.373084176316878026e-13, 4.882909690108456103e-15, -1.752674757796404004e-16,
+        -5.325667752910278274e+00, 6.731473624051895199e-03, -1.206602915214058922e-04, 2.934585064328037924e-06, -8.072524064572582676e-08, 2.374781537648773207e-09, -7.288289762208204225e-11, 2.302994455937336646e-12, -7.433977920148981485e-14, 2.446529164688891886e-15, -8.130920651757898506e-17,
+        -5.312665190146167227e+00, 6.281641220897731664e-03, -1.048162715074372949e-04, 2.373281573337097694e-06, -6.077997032142951114e-08, 1.664670116969531097e-09, -4.756486815463307335e-11, 1.399303250013734271e-12, -4.205323490426865523e-14, 1.287984341798493295e-15, -3.985265915110191583e-17,
+        -5.300503108623082937e+00, 5.889035182448304657e-03, -9.191267284581423132e-05, 1.946732832366302381e-06, -4.663776200798682655e-08, 1.194895876457934789e-09, -3.193856768768756398e-11, 8.789621395307576307e-13, -2.471085966903725308e-14, 7.077589089958150596e-16, -2.048617761661348258e-17,
+        -5.531972434662969285e+00, 1.031539979446180477e-02, -2.943216035166387940e-04, 1.137981746860934547e-05, -4.974770972407330464e-07, 2.325358620135340786e-08, -1.133842382275264023e-09, 5.691753693385372897e-11, -2.918697389729307266e-12, 1.533066648719749619e-13, -8.094306073630630845e-15,
+        -5.512435164424237755e+00, 9.260417336498752428e-03, -2.363603462365634206e-04, 8.176083686254563746e-06, -3.197825548138456891e-07, 1.337364659884509641e-08, -5.834378644555634781e-10, 2.620449291656597805e-11, -1.202278493510071519e-12, 5.641424437195612953e-14, -2.664912572682785460e-15,
+        -5.494799085298248009e+00, 8.403824411204172118e-03, -1.940330726310869939e-04, 6.072204708725433529e-06, -2.148664497748406210e-07, 8.129848286064250281e-09, -3.208850027091097954e-10, 1.303937960150777566e-11, -5.412679864697834272e-13, 2.295259896034516299e-14, -9.809452281475340742e-16,
+        -5.478722187832125279e+00, 7.694276964212987992e-03, -1.621753760727169113e-04, 4.633566969242922189e-06, -1.496957005978356585e-07, 5.171307308677494344e-09, -1.863578459137005057e-10, 6.914149768372808110e-12, -2.620463347823520534e-13, 1.013710820874808552e-14, -3.955538979336873529e-16,
+        -5.463947507625787736e+00, 7.096768775633624862e-03, -1.375934732474343863e-04, 3.616487568844933813e-06, -1.074856257064548760e-07, 3.415985635110882323e-09, -1.132507092771254598e-10, 3.865558525005071627e-12, -1.347821490217259036e-13, 4.793654818748880038e-15, -1.720820041823242360e-16,
+        -5.450277029310904631e+00, 6.586606332113961390e-03, -1.182257278391592230e-04, 2.877068350780642628e-06, -7.917221631876742143e-08, 2.329712917911702713e-09, -7.151448108249014937e-11, 2.260134477054914694e-12, -7.296660086276482523e-14, 2.401632046783023615e-15, -7.982560500578763576e-17,
+        -5.437554899521034102e+00, 6.145868319259811807e-03, -1.026928391239942601e-04, 2.326583495511597145e-06, -5.960615255953723960e-08, 1.632957811707802551e-09, -4.666844969577425631e-11, 1.373164266288848102e-12, -4.127356438703216099e-14, 1.264260969282444213e-15, -3.912282599070151697e-17,
+        -5.425656225835810531e+00, 5.761230819743621938e-03, -9.004359541653118870e-05, 1.908286873783373057e-06, -4.573381438300348800e-08, 1.172051771016190066e-09, -3.133452420313831441e-11, 8.624857469335280385e-13, -2.425112886378944433e-14, 6.946777189542294777e-16, -2.010972110364065736e-17,
+        -5.652289278447844900e+00, 1.010790972515554324e-02, -2.887467428138354420e-04, 1.117006625344515846e-05, -4.884668563834411309e-07, 2.283779670127847924e-08, -1.113772686655873972e-09, 5.591842473429890620e-11, -2.867824855919148726e-12, 1.506511292320259155e-13, -7.954856424984138278e-15,
+        -5.633146234887672854e+00, 9.072968212397298365e-03, -2.318567844606429123e-04, 8.024513307674970155e-06, -3.139578386164499650e-07, 1.313317755424810058e-08, -5.730533912471623431e-10, 2.574197764953411555e-11, -1.181208466239734131e-12, 5.543173151734726990e-14, -2.618752534665459218e-15,
+        -5.615868166215020274e+00, 8.232739649206493454e-03, -1.903161622702999247e-04, 5.959048933187224332e-06, -2.109326639569466643e-07, 7.982926650851122554e-09, -3.151450086371285312e-10, 1.280808707142456404e-11, -5.317353771522099237e-13, 2.255088875085733889e-14, -9.638707360502626740e-16,
+        -5.600119417298567548e+00, 7.536817109146366767e-03, -1.590535056497750181e-04, 4.546808656092009255e-06, -1.469422278728527575e-07, 5.077419931577135568e-09, -1.830090148111679301e-10, 6.790949774385823776e-12, -2.574104666597236583e-13, 9.958894727870179225e-15, -3.886380805409559826e-16,
+        -5.585647822136351692e+00, 6.950836494790384179e-03, -1.349328518574389329e-04, 3.548475811895027971e-06, -1.055000340826815488e-07, 3.353702977573265649e-09, -1.112070323627496037e-10, 3.796392178824584861e-12, -1.323878224782537574e-13, 4.709032829393659622e-15, -1.690609848321819712e-16,
+        -5.572259080092714534e+00, 6.450559315737781213e-03, -1.159300574680551590e-04, 2.822742154896604612e-06, -7.770381932552025151e-08, 2.287068473646583183e-09, -7.021892251875226130e-11, 2.219537415526473494e-12, -7.166540975836224147e-14, 2.359074063064312389e-15, -7.841887972520104792e-17,
+        -5.559800274055916702e+00, 6.018395878966745910e-03, -1.006910101519859434e-04, 2.282485376117518259e-06, -5.849653039156676147e-08, 1.602957372508759682e-09, -4.581992802137041820e-11, 1.348410218642678598e-12, -4.053490988592605390e-14, 1.241777876612841723e-15, -3.843094153537871518e-17,
+        -5.548148873875091702e+00, 5.641269778314448452e-03, -8.828193602581844957e-05, 1.871988828217290798e-06, -4.487947112908691687e-08, 1.150444949869822798e-09, -3.076286264556182256e-11, 8.468852055819136223e-13, -2.381566211031508027e-14, 6.822826501400942335e-16, -1.975290230787127967e-17,
+        -5.770232108661899062e+00, 9.912269450063730669e-03, -2.834715547982924141e-04, 1.097129591361205520e-05, -4.799204512010944297e-07, 2.244315007576691452e-08, -1.094713722780847902e-09, 5.496923070813430393e-11, -2.819476965710368617e-12, 1.481266010321569449e-13, -7.822250964212602703e-15,
+        -5.751460709839284924e+00, 8.896288636939971711e-03, -2.275966637706198972e-04, 7.880921155309848872e-06, -3.084345775425036879e-07, 1.290500105545176205e-08, -5.631946327158575415e-10, 2.530269100069298840e-11, -1.161189480656204607e-12, 5.449793940852497361e-14, -2.574869642608290125e-15,
+        -5.734520026922054647e+00, 8.071537655557762744e-03, -1.868011874028388281e-04, 5.851878684637312677e-06, -2.072034549859355626e-07, 7.843551433273695725e-09, -3.096969789352962991e-10, 1.258846520891497099e-11, -5.226805061089466616e-13, 2.216919121496724946e-14, -9.476424547804376298e-16,
+        -5.719080423925380074e+00, 7.388498112757630777e-03, -1.561020266909743316e-04, 4.464660172559733506e-06, -1.443325826167320924e-07, 4.988375998102870841e-09, -1.798312583375695162e-10, 6.673992934922700292e-12, -2.530079208897161234e-13, 9.789597303009646401e-15, -3.820664583006189863e-16,
+        -5.704894278933603680e+00, 6.813414579450911140e-03, -1.324180645809280941e-04, 3.484092751668954738e-06, -1.036185814987741053e-07, 3.294646252005217777e-09, -1.092681717887611478e-10, 3.730744669271104382e-12, -1.301144744333076665e-13, 4.628661026335239745e-15, -1.661909034395425627e-16,
+        -5.691770808306367613e+00, 6.322479779734268245e-03, -1.137607132826167226e-04, 2.771325584510872354e-06, -7.631272598990133091e-08, 2.246641017726018047e-09, -6.899005556773156036e-11, 2.181013279642566622e-12, -7.043020289311086584e-14, 2.318661305948898946e-15, -7.708269088320162746e-17,
+        -5.679559874259570762e+00, 5.898418221512595483e-03, -9.879974226348357455e-05, 2.240757514942834958e-06, -5.744552920797404013e-08, 1.574521994268288389e-09, -4.501523572926125193e-11, 1.324924441372414847e-12, -3.983383974230704470e-14, 1.220431908611016558e-15, -3.777386596766083532e-17,
+        -5.668141182190238325e+00, 5.528387959939081407e-03, -8.661790759731272191e-05, 1.837648311220374688e-06, -4.407041084309640322e-08, 1.129968969437339070e-09, -3.022082447672141963e-11, 8.320865040395732161e-13, -2.340242302261938345e-14, 6.705164609022412638e-16, -1.941409143935834485e-17,
+        -5.885934067455901975e+00, 9.727401276599899338e-03, -2.784704143133630316e-04, 1.078259139100222569e-05, -4.717998530392748256e-07, 2.206793327766266557e-08, -1.076584355657328257e-09, 5.406597819874048058e-11, -2.773453893552421052e-12, 1.457227697536842561e-13, -7.695953696777474088e-15,
+        -5.867513791076485852e+00, 8.729393531322597252e-03, -2.235590565981568714e-04, 7.744638943245326848e-06, -3.031879301161315645e-07, 1.268811611321236879e-08, -5.538191772293547369e-10, 2.488477332802817968e-11, -1.142137937183631728e-12, 5.360901480361821991e-14, -2.533084692992010651e-15,
+        -5.850891760642458195e+00, 7.919309764531787948e-03, -1.834707049964672682e-04, 5.750190245491382127e-06, -2.036618870128276270e-07, 7.711105326733765206e-09, -3.045172533515205178e-10, 1.237957549776227840e-11, -5.140652050995144608e-13, 2.180591656385132679e-14, -9.321934965665071954e-16,
+        -5.835744052272112015e+00, 7.248475533559227066e-03, -1.533061562841613924e-04, 4.386731916464960964e-06, -1.418548080592772586e-07, 4.903777662640703501e-09, -1.768106558599721763e-10, 6.562775145287053297e-12, -2.488199808313563222e-13, 9.628504785558571199e-15, -3.758117151874211472e-16,
+        -5.821827355265828174e+00, 6.683713397803675398e-03, -1.300364079512449284e-04, 3.423030501433996479e-06, -1.018325771200067514e-07, 3.238549464472956645e-09, -1.074255661815384181e-10, 3.668330799583767844e-12, -1.279523640040993540e-13, 4.552199151947259215e-15, -1.634597369277466625e-16,
+        -5.808954221981943000e+00, 6.201625469870188437e-03, -1.117066499569676453e-04, 2.722570865720509592e-06, -7.499246190215206003e-08, 2.208247101773083569e-09, -6.782241377708872127e-11, 2.144393477110999962e-12, -6.925564901374032298e-14, 2.280221443451864358e-15, -7.581140059560360376e-17,
+        -5.796977150373376908e+00, 5.785234494165156921e-03, -9.700933485858846824e-05, 2.201197384357066769e-06, -5.644822295496481849e-08, 1.547521746654990984e-09, -4.425076856536893343e-11, 1.302603451024994207e-12, -3.916730751777484178e-14, 1.200131424039489449e-15, -3.714880818314904117e-17,
+        -5.785777965471043061e+00, 5.421921031841220318e-03, -8.504291606548582713e-05, 1.805097530116283883e-06, -4.330281641716501853e-08, 1.110529658498518322e-09, -2.970596621012231045e-11, 8.180240184331912184e-13, -2.300960448501590244e-14, 6.593283175865547200e-16, -1.909184024574917021e-17,
+        -5.999516395626089071e+00, 9.552359230648494945e-03, -2.737206367528426478e-04, 1.060314001418267521e-05, -4.640712217126721685e-07, 2.171061978924696924e-08, -1.059312206149283849e-09, 5.320511655867790961e-11, -2.729577087940044841e-12, 1.434304165907448392e-13, -7.575485112145638212e-15,
+        -5.981428526609874119e+00, 8.571418881031776099e-03, -2.197254490550385028e-04, 7.615073530248679194e-06, -2.981958042075277135e-07, 1.248163125784400447e-08, -5.448892119253657187e-10, 2.448656515164823852e-11, -1.123979178411052680e-12, 5.276151437129704917e-14, -2.493237455339619141e-15,
+        -5.965108073778259801e+00, 7.775259541689734377e-03, -1.803092930372612293e-04, 5.653536791058422727e-06, -2.002929068124718147e-07, 7.585038858486479083e-09, -2.995847482104784222e-10, 1.218058087083983272e-11, -5.058554058805740915e-13, 2.145964484863477846e-14, -9.174640852175922695e-16,
+        -5.950236543271691936e+00, 7.116009704722073628e-03, -1.506528314912453299e-04, 4.312678468907060952e-06, -1.394982818986763175e-07, 4.823270970882669141e-09, -1.739348086455887970e-10, 6.456847004710772770e-12, -2.448299481665413478e-13, 9.474982293902236517e-15, -3.698494506216629064e-16,
+        -5.936574721751843420e+00, 6.561041703537444543e-03, -1.277766622238409402e-04, 3.365016221524641456e-06, -1.001343036528508451e-07, 3.185176073134028134e-09, -1.056715935389115721e-10, 3.608896432752804471e-12, -1.258928044698625257e-13, 4.479343569158308368e-15, -1.608567499852413573e-16,
+        -5.923938331418253433e+00, 6.087346974124382276e-03, -1.097581168200697599e-04, 2.676258526827137636e-06, -7.373728038734504703e-08, 2.171723658234953935e-09, -6.671113249169696713e-11, 2.109527837414774308e-12, -6.813699572241506788e-14, 2.243600751996392652e-15, -7.459997681665853307e-17,
+        -5.912182374186261136e+00, 5.678231825646513561e-03, -9.531122814719282489e-05, 2.163625665371204305e-06, -5.550024103592126578e-08, 1.521841179762043788e-09, -4.352332030118547518e-11, 1.281355106574906394e-12, -3.853259856636902321e-14, 1.180794707384858399e-15, -3.655327791946488454e-17,
+        -5.901190688377948135e+00, 5.321288341275529077e-03, -8.354938118374611667e-05, 1.774187978551801206e-06, -4.257330243737107765e-08, 1.092043371859045210e-09, -2.921611498546314413e-11, 8.046393384925595975e-13, -2.263559676391954321e-14, 6.486729081407776286e-16, -1.878485702119890840e-17,
+        -6.111089863393436517e+00, 9.386309127852262429e-03, -2.692020610859746730e-04, 1.043221733440516490e-05, -4.567043348823844547e-07, 2.136984448955315936e-08, -1.042832481375202545e-09, 5.238346464509319620e-11, -2.687686466546485776e-12, 1.412412712684960834e-13, -7.460414809512488688e-15,
+        -6.093317279736958803e+00, 8.421603321515496246e-03, -2.160793970106087032e-04, 7.491696475306324186e-06, -2.934384807296436613e-07, 1.228474971483164462e-08, -5.363709056073967372e-10, 2.410658048453768239e-11, -1.106646304802832598e-12, 5.195235068779802423e-14, -2.455184184095813770e-15,
+        -6.077282790515077693e+00, 7.638685630870836567e-03, -1.773032612964063257e-04, 5.561520448198787288e-06, -1.970830850263918088e-07, 7.464861169609284803e-09, -2.948806092405838298e-10, 1.199073213788289593e-11, -4.980205949969841356e-13, 2.112910349426822608e-14, -9.034006197427263611e-16,
+        -6.062673072043850198e+00, 6.990449650306702727e-03, -1.481304622153927842e-04, 4.242192402996777344e-06, -1.372535321829868990e-07, 4.746539871478332713e-09, -1.711926340272506519e-10, 6.355806470542539906e-12, -2.410228735114300343e-13, 9.328461087619830661e-15, -3.641577941784349801e-16,
+        -6.049252811420185338e+00, 6.444791471757629550e-03, -1.256288774064052863e-04, 3.309807190741341963e-06, -9.851688255105976009e-08, 3.134314955915589214e-09, -1.039994437427045965e-10, 3.552214306406137337e-12, -1.239280220910781675e-13, 4.409822382883841870e-15, -1.583723243046191350e-16,
+        -6.036840747731717194e+00, 5.979073359353934310e-03, -1.079064705169743881e-04, 2.632193405077706462e-06, -7.254206141669831990e-08, 2.136925201020755044e-09, -6.565186691909678525e-11, 2.076282121704003256e-12, -6.706999170746949982e-14, 2.208661629609941397e-15, -7.344391275156535326e-17,
+        -6.025294265591280229e+00, 5.576871667260659658e-03, -9.369783754948722424e-05, 2.127882962955704116e-06, -5.459769091941430551e-08, 1.497377329209823054e-09, -4.283002838133766730e-11, 1.261097071711463984e-12, -3.792728532715132574e-14, 1.162348638510658509e-15, -3.598504562208716060e-17,
+        -6.014499118779085052e+00, 5.225979881963794919e-03, -8.213058892313641456e-05, 1.744787699063656392e-06, -4.187885486492587019e-08, 1.074435536158094141e-09, -2.874933151029671145e-11, 7.918802868839516031e-13, -2.227896083839864242e-14, 6.385097000248170224e-16, -1.849198566512893458e-17,
+        -6.220755988112488311e+00, 9.228512200844200125e-03, -2.648967024710652371e-04, 1.026917526890574201e-05, -4.496721090158864766e-07, 2.104438251247009271e-08, -1.027086989282975287e-09, 5.159816315235335725e-11, -2.647638047507043535e-12, 1.391478910133152401e-13, -7.350355259404902911e-15,
+        -6.203282978194779140e+00, 8.279273026488186832e-03, -2.126062398317558856e-04, 7.374035302223627271e-06, -2.888982979986712365e-07, 1.209675694475517547e-08, -5.282338892404680833e-10, 2.374348435244697494e-11, -1.090079175358748458e-12, 5.117874662490244022e-14, -2.418795515403889879e-15,
+        -6.187520131118293243e+00, 7.508967691906962352e-03, -1.744404107928637995e-04, 5.473785658744302535e-06, -1.940203992873383558e-07, 7.350132271300237875e-09, -2.903879195257193032e-10, 1.180935655350807874e-11, -4.905333540497482904e-13, 2.081314833775927500e-14, -8.899548833838345358e-16,
+        -6.173159053403564300e+00, 6.871219911860100907e-03, -1.457287258345046129e-04, 4.174999113590849852e-06, -1.351120831016355718e-07, 4.673301190027711491e-09, -1.685741923692032088e-10, 6.259292674960572412e-12, -2.373853294122481702e-13, 9.188430026747622818e-15, -3.587170803412297446e-16,
+        -6.159968150781944374e+00, 6.334425489569289920e-03, -1.235841955772660128e-04, 3.257186693301228878e-06, -9.697416119268696613e-08, 3.085777028354861707e-09, -1.024030114539259881e-10, 3.498080512194067440e-12, -1.220510372140408128e-13, 4.343391327622582592e-15, -1.559978145196792049e-16,
+        -6.147769038068497061e+00, 5.876300426605843633e-03, -1.061440195448055040e-04, 2.590201316270938208e-06, -7.140222704730239211e-08, 2.103721478893551039e-09, -6.464072333468820343e-11, 2.044535929260570006e-12, -6.605082128711612852e-14, 2.175280500842615097e-15, -7.233915890644043511e-17,
+        -6.136421370690652743e+00, 5.480678632627055021e-03, -9.216241635737512075e-05, 2.093827068206605002e-06, -5.373709343780026143e-08, 1.474038044818536929e-09, -4.216832831239905221e-11, 1.241755522713913907e-12, -3.734918971509912336e-14, 1.144727572454712688e-15, -3.544210862147333817e-17,
+        -6.125812727647399036e+00, 5.135545652273763688e-03, -8.078056913148322924e-05, 1.716779002638836991e-06, -4.121678063513779594e-08, 1.057639432177274848e-09, -2.830387897748163814e-11, 7.797000955800839457e-13, -2.193840597625016447e-14, 6.288023156506145691e-16, -1.821218804269609399e-17,
+        -6.328608076353903655e+00, 9.078311557590090786e-03, -2.607884612224016583e-04, 1.011343212292347245e-05, -4.429501951618619596e-07, 2.073313137247804001e-08, -1.012023304295473651e-09, 5.084663420380897911e-11, -2.609301939400121216e-12, 1.371435577603205425e-13, -7.244956501281985678e-15,
+        -6.311420182235520038e+00, 8.143829222318994809e-03, -2.092928607699799258e-04, 7.261666154466262956e-06, -2.845593856041909249e-07, 1.191701011729106921e-08, -5.204508164294339711e-10, 2.339607375173712274e-11, -1.074223560243886970e-12, 5.043819663989792816e-14, -2.383954680770362472e-15,
+        -6.295915804076245514e+00, 7.385554793071440888e-03, -1.717098326123048181e-04, 5.390013603334036299e-06, -1.910940514952807876e-07, 7.240456507836626982e-09, -2.860914525938359367e-10, 1.163584814025748178e-11, -4.833689701418533571e-13, 2.051074754659470706e-14, -8.770833722730379427e-16,
+        -6.281791256456511263e+00, 6.757809684042470275e-03, -1.434383955613352513e-04, 4.110852476146118136e-06, -1.330663251470098170e-07, 4.603300389023235247e-09, -1.660705408697758934e-10, 6.166980694251020468e-12, -2.339052181135430095e-13, 9.054428332828438089e-15, -3.535095726149021046e-16,
+        -6.268818495501187193e+00, 6.229467130011201274e-03, -1.216347024835814450e-04, 3.206960567569048338e-06, -9.550061794550582430e-08, 3.039392392050687324e-09, -1.008768056731056757e-10, 3.446311519282539072e-12, -1.202555636459415052e-13, 4.279830283864183787e-15, -1.537254260747710375e-16,
+        -6.256821881159623011e+00, 5.778581040069006788e-03, -1.044638944883885838e-04, 2.550126261869824296e-06, -7.031367030989639807e-08, 2.071995498119230438e-09, -6.367420102314978683e-11, 2.014180928478029454e-12, -6.507604904145723772e-14, 2.143346042979509035e-15, -7.128206551340631340e-17,
+        -6.245663236195179380e+00, 5.389231314303253965e-03, -9.069894116608418616e-05, 2.061330663651011331e-06, -5.291532840473989693e-08, 1.451740583014245627e-09, -4.153591518965358637e-11, 1.223264057170159569e-12, -3.679635132435500347e-14, 1.127872391487378390e-15, -3.492266248860559183e-17,
+        -6.235231881386082087e+00, 5.049586904213555598e-03, -7.949399353205018894e-05, 1.690056558373060722e-06, -4.058466531588625840e-08, 1.041595169803462706e-09, -2.787819685957165209e-11, 7.680567105833784772e-13, -2.161277078452682960e-14, 6.195180041108496511e-16, -1.794452905284119602e-17,
+        -6.434732120283507051e+00, 8.935120911039725819e-03, -2.568628776991558216e-04, 9.964464150592055520e-06, -4.365166361953238589e-07, 2.043509578103059601e-08, -9.975940575602991880e-10, 5.012654693909623215e-11, -2.572560627826493978e-12, 1.352221904559112427e-13, -7.143901616528039832e-15,
+        -6.417816002628283556e+00, 8.014737806733989584e-03, -2.061274853235890020e-04, 7.154207587697555917e-06, -2.804074389212789104e-07, 1.174492917637072972e-08, -5.129969898101307393e-10, 2.306326144430054428e-11, -1.059030418972073176e-12, 4.972843377349483945e-14, -2.350555983024169684e-15,
+        -6.402557944104367849e+00, 7.267955768408903769e-03, -1.691017387372267789e-04, 5.309917492301337164e-06, -1.882943131049680309e-07, 7.135477011450887586e-09, -2.819774626730258251e-10, 1.146965945880080338e-11, -4.765051042586526013e-13, 2.022096791726765766e-14, -8.647467230305656566e-16,
+        -6.388658761247231865e+00, 6.649763796671333445e-03, -1.412511962134528273e-04, 4.049531182980217627e-06, -1.311094052497918422e-07, 4.536307973394885178e-09, -1.636736094466256232e-10, 6.078577102993075576e-12, -2.305716080122082945e-13, 8.926039424967388778e-15, -3.485192284351957196e-16,
+        -6.375893804529761510e+00, 6.129491870305352023e-03, -1.197733029174732704e-04, 3.158954295089008409e-06, -9.409128188361687482e-08, 2.995007918680239763e-09, -9.941587300431522664e-11, 3.396741645892872228e-12, -1.185359230925427253e-13, 4.218940313430282585e-15, -1.515481112100614635e-16,
+        -6.364090057942885181e+00, 5.685517111277036371e-03, -1.028599391118114128e-04, 2.511828074661988662e-06, -6.927269510395085422e-08, 2.041641848038182942e-09, -6.274914304274922988e-11, 1.985119354900594739e-12, -6.414257275648322259e-14, 2.112757677245786086e-15, -7.026933352037923310e-17,
+        -6.353111415660022132e+00, 5.302154677167626555e-03, -8.930201577231633447e-05, 2.030279389883192731e-06, -5.212958867374118836e-08, 1.430410415463448528e-09, -4.093071108634514278e-11, 1.205562767885045292e-12, -3.626700041771232878e-14, 1.111729699165566282e-15, -3.442507666297859849e-17,
+        -6.342848862907945140e+00, 4.967748899402105005e-03, -7.826609020733633719e-05, 1.664525784727452273e-06, -3.998033735517124086e-08, 1.026248820856732636e-09, -2.747087870652039641e-11, 7.569122021605990019e-13, -2.130100711961964905e-14, 6.106271922375681015e-16, -1.768816392905677452e-17,
+        -6.539207572427649495e+00, 8.798415144039841221e-03, -2.531069248384423321e-04, 9.821798383455426204e-06, -4.303515748455373826e-07, 2.014937469036509548e-08, -9.837563305162929591e-10, 4.943578807912183314e-11, -2.537307508500889101e-12, 1.333782699181264406e-13, -7.046902847035998390e-15,
+        -6.522550893517840898e+00, 7.891520665950274918e-03, -2.030995107007415310e-04, 7.051315298648072481e-06, -2.764295271695940211e-07, 1.157998922145836707e-08, -5.058500420476393235e-10, 2.274406210599106513e-11, -1.044455282856767115e-12, 4.904740139249221271e-14, -2.318503490488678297e-15,
+        -6.507527921726842024e+00, 7.155731159351880893e-03, -1.666073190714509680e-04, 5.233238569578460583e-06, -1.856123935170135627e-07, 7.034870977042522786e-09, -2.780335057168393418e-10, 1.131029457774630151e-11, -4.699215077255352599e-13, 1.994296315083677589e-14, -8.529092226159118006e-16,
+        -6.493843783915648871e+00, 6.546675184151931615e-03, -1.391596823950292370e-04, 3.990835636187113038e-06, -1.292351333766034065e-07, 4.472116429284964895e-09, -1.613760948905914995e-10, 5.993816178445289862e-12, -2.273745939006189123e-13, 8.802885648247762181e-15, -3.437314979717507951e-16,
+        -6.481277079861146539e+00, 6.034120214037898972e-03, -1.179936155204839812e-04, 3.113010533304973023e-06, -9.274166457159404190e-08, 2.952485193535098502e-09, -9.801573224888490046e-11, 3.349220901762647018e-12, -1.168869720795504600e-13, 4.160541125317227940e-15, -1.494594799882417194e-16,
+        -6.469657305070240838e+00, 5.596752914494080265e-03, -1.013266184795292809e-04, 2.475180424323555325e-06, -6.827596515345235412e-08, 2.012565276522796859e-09, -6.186269427980792800e-11, 1.957262730222330521e-12, -6.324758325299842869e-14, 2.083424279721996995e-15, -6.929797268802050486e-17,
+        -6.458850336009006377e+00, 5.219113718914501765e-03, -8.796679014159907253e-05, 2.000570208560067807e-06, -5.137734114099996670e-08, 1.409980215978570538e-09, -4.035083728430771514e-11, 1.188597453389745908e-12, -3.575953487848132187e-14, 1.096251132055566424e-15, -3.394787362408342394e-17,
+        -6.448748750527106388e+00, 4.889714875222711879e-03, -7.709257152739802590e-05, 1.640101488016406472e-06, -3.940183774649430081e-08, 1.011551682002994614e-09, -2.708065324771837978e-11, 7.462322622842836105e-13, -2.100216636349192446e-14, 6.021031013670839146e-16, -1.744232739102363885e-17,
+        -6.642108018353605203e+00, 8.667722367136565173e-03, -2.495088317207588445e-04, 9.685006508766578283e-06, -4.244370038957198073e-07, 1.987515019066582185e-08, -9.704711345555767947e-10, 4.877243664411994079e-11, -2.503445626230233756e-12, 1.316067741946942988e-13, -6.953698253890800517e-15,
+        -6.625699340328981002e+00, 7.773748371951366871e-03, -2.001993608982236851e-04, 6.952677628758672266e-06, -2.726139293083312845e-07, 1.142171398304480530e-08, -4.989896623038165882e-10, 2.243758043715529353e-11, -1.030457724479228546e-12, 4.839322889579115439e-14, -2.287709913572397501e-15,
+        -6.610901045240257901e+00, 7.048486442501875927e-03, -1.642186200219721514e-04, 5.159742706142847482e-06, -1.830403276251487474e-07, 6.938345618004873928e-09, -2.742482860317425025e-10, 1.115730304285314564e-11, -4.635997787610067095e-13, 1.967596377878505210e-14, -8.415383868929619271e-16,
+        -6.597422391745068282e+00, 6.448178561354191152e-03, -1.371571351095286827e-04, 3.934585300488889656e-06, -1.274379027680598250e-07, 4.410537605533471456e-09, -1.591713702103917673e-10, 5.912456646270076330e-12, -2.243051770367456551e-13, 8.684623746561880316e-15, -3.391331512278460002e-16,
+        -6.585045093833119090e+00, 5.943011751178564443e-03, -1.162898835545830243e-04, 3.068987014642746258e-06, -9.144770184136379545e-08, 2.911698757363692301e-09, -9.667231841440524180e-11, 3.303613139241275865e-12, -1.153040392723913830e-13, 4.104468900458210267e-15, -1.474537238716719634e-16,
+        -6.573601053749460910e+00, 5.511969480171649213e-03, -9.985894106387642065e-05, 2.440069119985001954e-06, -6.732046046121176683e-08, 1.984679472656748754e-09, -6.101226555809936678e-11, 1.930530765040829332e-12, -6.238852994728395912e-14, 2.055263075338064794e-15, -6.836526561366253207e-17,
+        -6.562958047290702090e+00, 5.139808156014242374e-03, -8.668889174475767428e-05, 1.972110009824087594e-06, -5.065629349214648226e-08, 1.390388995179130060e-09, -3.979459052357324135e-11, 1.172318941992678208e-12, -3.527250045937961953e-14, 1.081392769456693252e-15, -3.348971101649041679e-17,
+        -6.553010178079127890e+00, 4.815200989725444344e-03, -7.596957310765392146e-05, 1.616706704696962728e-06, -3.884739417327016835e-08, 9.974596454307337871e-10, -2.670636823571594431e-11, 7.359857745246612080e-13, -2.071538766780556998e-14, 5.939214188026720810e-16, -1.720632433827298061e-17,
+        -6.743501763199438948e+00, 8.542617198425739994e-03, -2.460579328540293668e-04, 9.553699621588689493e-06, -4.187565515767416713e-07, 1.961167795679454056e-08, -9.577029627723490356e-10, 4.813474215307884880e-11, -2.470886586648331767e-12, 1.299031227370620643e-13, -6.864048829965175139e-15,
+        -6.727330459172653043e+00, 7.661034008406997046e-03, -1.974183629919427777e-04, 6.858011712203656738e-06, -2.689499931433127972e-07, 1.126967021230877186e-08, -4.923973607472655579e-10, 2.214300091670985715e-11, -1.017000900118321283e-12, 4.776421074642280986e-14, -2.258095634558391078e-15,
+        -6.712747172001795271e+00, 6.945866308264274543e-03, -1.619284409183441114e-04, 5.089217483431657639e-06, -1.805708793264560739e-07, 6.845634690700841256e-09, -2.706115243104236011e-10, 1.101027468282847485e-11, -4.575231526264575339e-13, 1.941926847288982309e-14, -8.306045968648427137e-16,
+        -6.699465125500656093e+00, 6.353945084403895931e-03, -1.352374736123722137e-04, 3.880616438087889276e-06, -1.257126215361762599e-07, 4.351400464540828310e-09, -1.570534066704532849e-10, 5.834278879127450930e-12, -2.213551618176104393e-13, 8.570940959364854381e-15, -3.347121288746560773e-16,
+        -6.687269021809163050e+00, 5.855860146302138865e-03, -1.146568988669899222e-04, 3.026754749688945725e-06, -9.020570388582033474e-08, 2.872534596962302475e-09, -9.538193458643569512e-11, 3.259794462435530337e-12, -1.137828714988732284e-13, 4.050574417142975221e-15, -1.455255498207035102e-16,
+        -6.675993072158573405e+00, 5.430879867233806904e-03, -9.845239240324496022e-05, 2.406390659181998209e-06, -6.640344000059689061e-08, 1.957906022117038049e-09, -6.019550280204093703e-11, 1.904850415167815543e-12, -6.156309120641783512e-14, 2.028198685148750317e-15, -6.746873672135448145e-17,
+        -6.665506874293972039e+00, 5.063967945068951863e-03, -8.546436710374422021e-05, 1.944814422389371314e-06, -4.996436572443447428e-08, 1.371581358233434612e-09, -3.926042260478580886e-11, 1.156682510666523790e-12, -3.480457378808391283e-14, 1.067114625136161193e-15, -3.304936624852947609e-17,
+        -6.655705995269126873e+00, 4.743952063376158552e-03, -7.489360186557735813e-05, 1.594271712553227087e-06, -3.831539887527776757e-08, 9.839326592529034916e-10, -2.634697657611742905e-11, 7.261444444284350341e-13, -2.043988784266699722e-14, 5.860600150300942535e-16, -1.697952183469697036e-17,
+        -6.843452345134706682e+00, 8.422715049682448149e-03, -2.427445388804817198e-04, 9.427523707735370787e-06, -4.132952964696620984e-07, 1.935827899656545341e-08, -9.454194023428166629e-10, 4.752110575454385297e-11, -2.439549613550173459e-12, 1.282631280106025612e-13, -6.777735995654754055e-15,
+        -6.827508521250639895e+00, 7.553027925100232014e-03, -1.947486410821195593e-04, 6.767060162458447358e-06, -2.654280138822364376e-07, 1.112346283807001827e-08, -4.860562650375026972e-10, 2.185957893914205917e-11, -1.004051153629871895e-12, 4.715878830709398471e-14, -2.229587866617432276e-15,
+        -6.813131242925535958e+00, 6.847549803267754046e-03, -1.597302452677126241e-04, 5.021469685968935547e-06, -1.781974583971634369e-07, 6.756495495912488862e-09, -2.671138436448527875e-10, 1.086883511860104627e-11, -4.516763200538261693e-13, 1.917223652095423134e-14, -8.200807835232452488e-16,
+        -6.800037543304759069e+00, 6.263677820433629501e-03, -1.333951799304774924e-04, 3.828780162358025913e-06, -1.240546537669730276e-07, 4.294549142772965960e-09, -1.550167064839943849e-10, 5.759082475860655526e-12, -2.185170664195012827e-13, 8.461551643706986083e-15, -3.304574130818994721e-16,
+        -6.788014994827044291e+00, 5.772388888647040327e-03, -1.130899368145155435e-04, 2.986196484038952765e-06, -8.901231230773737652e-08, 2.834888844172254468e-09, -9.414121039697339614e-11, 3.217651853104061472e-12, -1.123195870888346993e-13, 3.998721429426677352e-15, -1.436701232514830023e-16,
+        -6.776900026345716199e+00, 5.353225156198292665e-03, -9.710287834947162633e-05, 2.374050982223216603e-06, -6.552240962090059841e-08, 1.932173507175385913e-09, -5.941026043784449527e-11, 1.880155066855531951e-12, -6.076914873273699043e-14, 2.002162302525097370e-15, -6.660612543165748323e-17,
+        -6.766563985244056667e+00, 4.991349488956260856e-03, -8.428963180866767238e-05, 1.918606792508031948e-06, -4.929966565859842487e-08, 1.353506865617194203e-09, -3.874692280185272570e-11, 1.141647383516044113e-12, -3.435454768824710700e-14, 1.053380208007241045e-15, -3.262572317193788881e-17,
+        -6.756903843763429229e+00, 4.675737973615396760e-03, -7.386149162344390266e-05, 1.572733182555441938e-06, -3.780438962328325226e-08, 9.709342629739566967e-10, -2.600152437283854087e-11, 7.166824806323666430e-13, -2.017495262617947141e-14, 5.784986993790714792e-16, -1.676134217855235640e-17,
+        -6.942018986553058824e+00, 8.307667245732461639e-03, -2.395598252140943517e-04, 9.306155740788834906e-06, -4.080396072609969470e-07, 1.911433249703567924e-08, -9.335907981214313930e-10, 4.693006383622346468e-11, -2.409360729456183679e-12, 1.266829534033909418e-13, -6.694559419356613495e-15,
+        -6.926293413392845544e+00, 7.449413260526882401e-03, -1.921830250040293506e-04, 6.679588211045917737e-06, -2.620391290579327121e-07, 1.098273077060376626e-08, -4.799509438000499826e-10, 2.158663312014275088e-11, -9.915776723001244580e-13, 4.657553404879713522e-14, -2.202119922277816528e-15,
+        -6.912113751630731606e+00, 6.753246186843222393e-03, -1.576180844091843618e-04, 4.956323137355767236e-06, -1.759140486100415045e-07, 6.670706282150209667e-09, -2.637466707075725681e-10, 1.073264186670347910e-11, -4.460452695763679196e-13, 1.893428128880486809e-14, -8.099421538514075858e-16,
+        -6.899200697783060221e+00, 6.177107885586001490e-03, -1.316252339618862832e-04, 3.778940758908324019e-06, -1.224597686131307594e-07, 4.239841271997095016e-09, -1.530562444901301192e-10, 5.686684161925397996e-12, -2.157840452377062453e-13, 8.356194340385783564e-15, -3.263589152668907644e-16,
+        -6.887344584222030441e+00, 5.692347671077853388e-03, -1.115847003366197591e-04, 2.947205367749373027e-06, -8.786446301214929517e-08, 2.798666650270728337e-09, -9.294706605212590974e-11, 3.177081979408129452e-12, -1.109106353922668124e-13, 3.948785259331811229e-15, -1.418830184857859284e-16,
+        -6.876383971880812851e+00, 5.278771036984071865e-03, -9.580667631574705525e-05, 2.342964398633537952e-06, -6.467509433074573135e-08, 1.907416728351125596e-09, -5.865457836435000734e-11, 1.856383830728837241e-12, -6.000476534890979921e-14, 1.977090978237856874e-15, -6.577536286441317617e-17,
+        -6.866191890091783101e+00, 4.921732407591345934e-03, -8.316142759902405866e-05, 1.893417304337829599e-06, -4.866046779938952800e-08, 1.336119480488806349e-09, -3.825280264062864895e-11, 1.127176297321075353e-12, -3.392131845391941107e-14, 1.040156141016664045e-15, -3.221776051970629056e-17,
+        -6.856666661772306881e+00, 4.610350587374897023e-03, -7.287036500083618115e-05, 1.552033448451400291e-06, -3.731303330133105639e-08, 9.584311860447011688e-10, -2.566914058529352212e-11, 7.075763187212329519e-13, -1.991992911841046302e-14, 5.712190081316649104e-16, -1.655125688921997043e-17,
+        -7.039256991963594778e+00, 8.197156837426914852e-03, -2.364957357544119362e-04, 9.189300297348370215e-06, -4.029770035185022257e-07, 1.887926960098206498e-08, -9.221899596787308305e-10, 4.636027373922798884e-11, -2.380252040893626447e-12, 1.251590764912745349e-13, -6.614335114285762382e-15,
+        -7.023741043962583142e+00, 7.349902103405698238e-03, -1.897149714449843300e-04, 6.595381227621578372e-06, -2.587752272864744198e-07, 1.084714325308565297e-08, -4.740672529803966289e-10, 2.132353859383475252e-11, -9.795521868373138771e-13, 4.601313777620195431e-14, -2.175630574978420817e-15,
+        -7.009751157727017734e+00, 6.662691380961731011e-03, -1.555865315795252821e-04, 4.893616825650806309e-06, -1.737151453478664662e-07, 6.588063988972488532e-09, -2.605021497828160196e-10, 1.060138094646946547e-11, -4.406171501471049795e-13, 1.870486452000417778e-14, -8.001659518048968728e-16,
+        -6.997011556200256166e+00, 6.093991138024284701e-03, -1.299230574538620848e-04, 3.730974231862530850e-06, -1.209240961322990113e-07, 4.187146520999902302e-09, -1.511674174377488738e-10, 5.616915962095330514e-12, -2.131498213357999940e-13, 8.254629217127968002e-15, -3.224073782156559698e-16,
+        -6.985315228163425871e+00, 5.615509291044433644e-03, -1.101372717015592880e-04, 2.909683803779906086e-06, -8.675935402959835192e-08, 2.763781208605778761e-09, -9.179668106443535261e-11, 3.137990159569984234e-12, -1.095527615361092393e-13, 3.900651570460139116e-15, -1.401601755622461511e-16,
+        -6.974502786405890831e+00, 5.207304890024184833e-03, -9.456039323119377134e-05, 2.313052658395006969e-06, -6.385941427403356410e-08, 1.883576028837119426e-09, -5.792666194343006729e-11, 1.833480927766206784e-12, -5.926816566506546048e-14, 1.952926997897968604e-15, -6.497455153999485110e-17,
+        -6.964448878740554072e+00, 4.854916776794668438e-03, -8.207678536387579850e-05, 1.869182219241852697e-06, -4.804519501921865847e-08, 1.319377089207932078e-09, -3.777688267815468794e-11, 1.113235123852872574e-12, -3.350387477880895470e-14, 1.027411829381873375e-15, -3.182454183551663096e-17,
+        -6.955053127657028433e+00, 4.547601139366354468e-03, -7.191760057485342174e-05, 1.532119875339746299e-06, -3.684011168651912178e-08, 9.463929996698403723e-10, -2.534902804797233593e-11, 6.988043812508568830e-13, -1.967421920141413156e-14, 5.642040201284604205e-16, -1.634878147140641087e-17,
+        -7.135218100063292823e+00, 8.090894994866034556e-03, -2.335448993321493044e-04, 9.076686611446934061e-06, -3.980960343184311419e-07, 1.865256797453022843e-08, -9.111919053311266456e-10, 4.581050126618995846e-11, -2.352161113005682592e-12, 1.236882568752843024e-13, -6.536893771328716010e-15,
+        -7.119903701830127218e+00, 7.254232188266142474e-03, -1.873384955310533390e-04, 6.514242563008232052e-06, -2.556288687669094967e-07, 1.071639667852178112e-08, -4.683922016680430519e-10, 2.106972115467157710e-11, -9.679487089919894184e-13, 4.547039457361735407e-14, -2.150063500082476429e-15,
+        -7.106096252139224134e+00, 6.575644915904532185e-03, -1.536306247596253862e-04, 4.833203273685167560e-06, -1.715957012715231055e-07, 6.508382279150151372e-09, -2.573730677268032327e-10, 1.047476391615826152e-11, -4.353801510435193362e-13, 1.848349134985122859e-14, -7.907312491351552275e-16,
+        -7.093523371677131095e+00, 6.014105334254775392e-03, -1.282844654647145627e-04, 3.684767040653723660e-06, -1.194440888440972061e-07, 4.136345324511900831e-09, -1.493459997358750504e-10, 5.549623604855091766e-12, -2.106086274193623945e-13, 8.156635833091192388e-15, -3.185942904601229753e-16,
+        -7.081980608374373709e+00, 5.541666987034826047e-03, -1.087440707168543840e-04, 2.873542447770311691e-06, -8.569441751753214470e-08, 2.730152903041592972e-09, -9.068746698272182934e-11, 3.100289457285116571e-12, -1.082429756403995190e-13, 3.854215296138478339e-15, -1.384978624699318247e-16,
+        -7.071310551522411281e+00, 5.138633278706815528e-03, -9.336092914284140195e-05, 2.284244145557032185e-06, -6.307346383333906857e-08, 1.860596706107207792e-09, -5.722486455498655086e-11, 1.811395153537405339e-12, -5.855771919818555586e-14, 1.929617338037845436e-15, -6.420194763533638018e-17,
+        -7.061389407809331331e+00, 4.790720757273209465e-03, -8.103299312386387325e-05, 1.845843215554609995e-06, -4.745240263185574411e-08, 1.303241083875214397e-09, -3.731808098032141587e-11, 1.099792540437627692e-12, -3.310128809303710725e-14, 1.015119170832349197e-15, -3.144520667355165206e-17,
+        -7.052118051311852653e+00, 4.487317981690115698e-03, -7.100080447213263154e-05, 1.512944311823036995e-06, -3.638450908843809151e-08, 9.347918137530694338e-10, -2.504045564621188885e-11, 6.903468684933424679e-13, -1.943727379761143223e-14, 5.574381957707830448e-16, -1.615347084124002324e-17,
+        -7.229950796264547286e+00, 7.988617888338779213e-03, -2.307005569512966293e-04, 8.968066002616903278e-06, -3.933861720917899841e-07, 1.843374705024551160e-08, -9.005736377887886504e-10, 4.527960972407178481e-11, -2.325030420640362032e-12, 1.222675079363937664e-13, -6.462079294239566100e-15,
+        -7.214830374866350482e+00, 7.162164039611429965e-03, -1.850481112862848690e-04, 6.435991666827966159e-06, -2.525932157850368355e-07, 1.059021180385814629e-08, -4.629138345523801857e-10, 2.082465212154038024e-11, -9.567433013754071926e-13, 4.494619422420337985e-14, -2.125366783970130895e-15,
+        -7.201198481088544767e+00, 6.491887292022300443e-03, -1.517458169577633523e-04, 4.774947117522101304e-06, -1.695510788469971856e-07, 6.431489817156258222e-09, -2.543527882590302513e-10, 1.035252527562396541e-11, -4.303233965559584169e-13, 1.826970593067884475e-14, -7.816187617679585706e-16,
+        -7.188786012260012903e+00, 5.937247674087440044e-03, -1.267056241604795272e-04, 3.640214998634352591e-06, -1.180164881543811906e-07, 4.087327771701450530e-09, -1.475881047222181349e-10, 5.484665124689005845e-12, -2.081551540965599020e-13, 8.062011178224248869e-15, -3.149118111454666537e-16,
+        -7.177390983950886039e+00, 5.470632140124874823e-03, -1.074018184089706223e-04, 2.838699336293646578e-06, -8.466729531613307545e-08, 2.697708563592121124e-09, -8.961704353167955615e-11, 3.063899889621811406e-12, -1.069785258446894208e-13, 3.809379699695657897e-15, -1.368926420209705354e-16,
+        -7.166857891068516118e+00, 5.072579786472132014e-03, -9.220544559343971211e-05, 2.256473175686180237e-06, -6.231549339273525742e-08, 1.838428497769471875e-09, -5.654767233854532249e-11, 1.790079409226622806e-12, -5.787192558595918864e-14, 1.907113189405628963e-15, -6.345594542480199448e-17,
+        -7.157064443114545149e+00, 4.728978550320648427e-03, -8.002756822439025441e-05, 1.823346813566239472e-06, -4.688076449769812254e-08, 1.287675997669750748e-09, -3.687540304706135718e-11, 1.086819741679013044e-12, -3.271270410156823270e-14, 1.003252301737511170e-15, -3.107896288431495070e-17,
+        -7.147912720627697780e+00, 4.429344644279712903e-03, -7.011778570558695645e-05, 1.494462613027749281e-06, -3.594520156874417985e-08, 9.236020122528998675e-10, -2.474275147700571528e-11, 6.821855753815457559e-13, -1.920858784367739462e-14, 5.509072360044321529e-16, -1.596491531800530081e-17,
+        -7.323500590962850332e+00, 7.890083981040515310e-03, -2.279564982228916511e-04, 8.863209623068841732e-06, -3.888377194933942737e-07, 1.822236384901154266e-08, -8.903139469254191051e-10, 4.476655028457427700e-11, -2.298806865149344576e-12, 1.208940719581520794e-13, -6.389747508893814076e-15,
+        -7.308567033387364908e+00, 7.073478494547209838e-03, -1.828387796408910448e-04, 6.360462439512548252e-06, -2.496619717725949803e-07, 1.046833130422926816e-08, -4.576211286372491879e-10, 2.058784382156533792e-11, -9.459138749265800170e-13, 4.443951189508973908e-14, -2.101492491661391259e-15,
+        -7.295104234296238666e+00, 6.411217692327638232e-03, -1.499279328167305730e-04, 4.718723862479403473e-06, -1.675770087349650834e-07, 6.357228758496729347e-09, -2.514351942490475043e-10, 1.023442018334630693e-11, -4.254368533645434614e-13, 1.806308758215274172e-14, -7.728106881417270099e-16,
+        -7.282846253535042003e+00, 5.863232673093022630e-03, -1.251830139956451756e-04, 3.597222309658394877e-06, -1.166382949377709775e-07, 4.039992631186611015e-09, -1.458901506579058509e-10, 5.421909634013555755e-12, -2.057845043900029407e-13, 7.970567948577759556e-15, -3.113527039077892175e-16,
+        -7.271593488091188995e+00, 5.402232283020794168e-03, -1.061075053491217262e-04, 2.805079124604986209e-06, -8.367581753946235251e-08, 2.666380813718336229e-09, -8.858321767058044157e-11, 3.028747731308098631e-12, -1.057568746018465497e-13, 3.766055548119086913e-15, -1.353413427061481157e-16,
+        -7.261192271709367319e+00, 5.008983144041224099e-03, -9.109133805457535302e-05, 2.229679381777106218e-06, -6.158389337070587492e-08, 1.817025130886110716e-09, -5.589369080606150679e-11, 1.769490289859705293e-12, -5.720940159598265051e-14, 1.885369537911409689e-15, -6.273506359618317854e-17,
+        -7.251521763900383277e+00, 4.669538628422053098e-03, -7.905823310315568896e-05, 1.801643873075511556e-06, -4.632906086251830110e-08, 1.272649185301935124e-09, -3.644793297582210189e-11, 1.074290186421879494e-12, -3.233733535232174963e-14, 9.917873740051929224e-16, -3.072507983217834161e-17,
+        -7.242485209168126659e+00, 4.373538156772228611e-03, -6.926653468835596602e-05, 1.476634223949773942e-06, -3.552124750852783049e-08, 9.128000213485928546e-10, -2.445529685216465049e-11, 6.743037308780854780e-13, -1.898769587731734402e-14, 5.445979584305447486e-16, -1.578273710099495319e-17,
+        -7.415910268016115303e+00, 7.795071670935688722e-03, -2.253070056537741098e-04, 8.761906478396622240e-06, -3.844417274539280647e-07, 1.801800929958464707e-08, -8.803932358929584637e-10, 4.427035347960774888e-11, -2.273441347833336929e-12, 1.195653981544480827e-13, -6.319765022764828740e-15,
+        -7.401156883141899456e+00, 6.987974546095527401e-03, -1.807058628867638848e-04, 6.287501785095599907e-06, -2.468293277091053723e-07, 1.035051761951861324e-08, -4.525039022219150115e-10, 2.035884560747419774e-11, -9.354400102017805587e-13, 4.394939991389173544e-14, -2.078396284928021854e-15,
+        -7.387857102112984187e+00, 6.333451992179214146e-03, -1.481731306190588963e-04, 4.664418791183473956e-06, -1.656695532094009907e-07, 6.285453420145319067e-09, -2.486146368782097940e-10, 1.012022244399640275e-11, -4.207112488434243911e-13, 1.786324739398401242e-14, -7.642905664796968080e-16,
+        -7.375748039594372862e+00, 5.791890312236086004e-03, -1.237133974874862167e-04, 3.555700722741280859e-06, -1.153067436855473423e-07, 3.994246493257580575e-09, -1.442488307842389295e-10, 5.361236241038272879e-12, -2.034921536298482149e-13, 7.882133024853467901e-15, -3.079102785171847699e-16,
+        -7.364632392640129588e+00, 5.336309369214742131e-03, -1.048583639412911032e-04, 2.772612418056527465e-06, -8.271798376803181660e-08, 2.636107496292566918e-09, -8.758396515983404584e-11, 2.994764901897814914e-12, -1.045756777833623395e-13, 3.724160383332993417e-15, -1.338410329817902730e-16,
+        -7.354358270837462186e+00, 4.947695601955774507e-03, -9.001621181670076241e-05, 2.203807175805714106e-06, -6.087718019787794852e-08, 1.796343925740191438e-09, -5.526163306169976781e-11, 1.749587721699980030e-12, -5.656886967923115780e-14, 1.864344795194238620e-15, -6.203793318149833707e-17,
+        -7.344806233901674197e+00, 4.612262198191201951e-03, -7.812289410343138359e-05, 1.780689152972281790e-06, -4.579616768076385277e-08, 1.258130542155974512e-09, -3.603482568808217660e-11, 1.062179374996076412e-12, -3.197445468966000674e-14, 9.807023584550312110e-16, -3.038288241502806214e-17,
+        -7.335880650224971156e+00, 4.319767591228096393e-03, -6.844520445408370818e-05, 1.459421814345945505e-06, -3.511177932953678777e-08, 9.023641057335852916e-10, -2.417752102437957934e-11, 6.666858566057384440e-13, -1.877416815086511917e-14, 5.384981881478008458e-16, -1.560658716385209229e-17,
+        -7.507220107234508610e+00, 7.703377229858542757e-03, -2.227468056722839993e-04, 8.663961683548673635e-06, -3.801899228676826047e-07, 1.782030498750527939e-08, -8.707933673963004063e-10, 4.379012167775536909e-11, -2.248888392377965256e-12, 1.182791232112503008e-13, -6.252008214463109872e-15,
+        -7.492640591739928801e+00, 6.905467459344817593e-03, -1.786450846595026424e-04, 6.216968336607432164e-06, -2.440899148470409573e-07, 1.023655105297132634e-08, -4.475527344694803248e-10, 2.013724033586768964e-11, -9.253027992563655442e-13, 4.347498048919874548e-14, -2.056037084096919046e-15,
+        -7.479498105564634791e+00, 6.258421021583067054e-03, -1.464778689170037249e-04, 4.611926002253194170e-06, -1.638250739049660036e-07, 6.216029107065696775e-09, -2.458858907326027548e-10, 1.000972272958789773e-11, -4.161379988063861900e-13, 1.766982521976474777e-14, -7.560431484394035507e-16,
+        -7.467532716431051654e+00, 5.723064423066698790e-03, -1.222937909240597693e-04, 3.515568788129641911e-06, -1.140192797211235673e-07, 3.950003013074753355e-09, -1.426610868823331336e-10, 5.302533093570821687e-12, -2.012739139944063570e-13, 7.796546126585329541e-15, -3.045783392348845616e-16,
+        -7.456549344606109742e+00, 5.272718263090598809e-03, -1.036518441017637881e-04, 2.741235183923519543e-06, -8.179194647868339673e-08, 2.606831167306533480e-09, -8.661741428934584004e-11, 2.961888424437965018e-12, -1.034327662118750022e-13, 3.683617877805499478e-15, -1.323889985222569418e-16,
+        -7.446397816016527393e+00, 4.888581511400260163e-03, -8.897786083695931780e-05, 2.178805275194646450e-06, -6.019398396672789508e-08, 1.776345446471613296e-09, -5.465030940633686029e-11, 1.730334642047345860e-12, -5.594914785624536562e-14, 1.844000472037970381e-15, -6.136328688295131118e-17,
+        -7.436960043545139065e+00, 4.557021860488186422e-03, -7.721962289233677069e-05, 1.760440924031255645e-06, -4.528104721468642843e-08, 1.244092256725911942e-09, -3.563530007157251359e-11, 1.050464652565197755e-12, -3.162338947170407110e-14, 9.699768710460260179e-16, -3.005174577668072923e-17,
+        -7.428141481627971388e+00, 4.267912792211386343e-03, -6.765209419109465721e-05, 1.442790957828841745e-06, -3.471599620669834987e-08, 8.922741891055247423e-10, -2.390889653579317547e-11, 6.593176420780912920e-13, -1.856760719923666515e-14, 5.325966613073337462e-16, -1.543614250938537931e-17,
+        -7.597468084121021370e+00, 7.614812996638144725e-03, -2.202710254519687041e-04, 8.569194921829606669e-06, -3.760746446096978259e-07, 1.762890027560858602e-08, -8.614975274324502294e-10, 4.332502241121383844e-11, -2.225105809789813812e-12, 1.170330540104994737e-13, -6.186362336226606311e-15,
+        -7.583056491845677982e+00, 6.825787120628683952e-03, -1.766524946741332143e-04, 6.148731330344915240e-06, -2.414387629002947289e-07, 1.012622808784315226e-08, -4.427588941425637765e-10, 1.992264124487555666e-11, -9.154847053821154201e-13, 4.301543925004246757e-14, -2.034376767778458755e-15,
+        -7.570065902714191886e+00, 6.185969043135472120e-03, -1.448388771386053717e-04, 4.561147561602649003e-06, -1.620402033027000704e-07, 6.148831073694241310e-09, -2.432441140292450367e-10, 9.902727002947204170e-12, -4.117091434354077035e-13, 1.748248700998913932e-14, -7.480542869717838794e-16,
+        -7.558239241233899008e+00, 5.656611273891048487e-03, -1.209214394525985815e-04, 3.476751200760831158e-06, -1.127735390635312395e-07, 3.907182241139024597e-09, -1.411240858631728944e-10, 5.245696531863879460e-12, -1.991259030771872173e-13, 7.713658618569137513e-15, -3.013511389934959187e-16,
+        -7.547383578188932240e+00, 5.211325418457476294e-03, -1.024855918519480580e-04, 2.710888232496467864e-06, -8.089599640502064626e-08, 2.578498648107178447e-09, -8.568183147637933648e-11, 2.930059946018341594e-12, -1.023261292957675062e-13, 3.644357263230250136e-15, -1.309827220435586346e-16,
+        -7.537350399570599713e+00, 4.831516082572492356e-03, -8.797424912676380954e-05, 2.154626285173866259e-06, -5.953303752349659949e-08, 1.756993192191771673e-09, -5.405861813913941327e-11, 1.711696715723404896e-12, -5.534914075711064447e-14, 1.824300888904754512e-15, -6.070994960805230324e-17,
+        -7.528022926950448834e+00, 4.503700438553965082e-03, -7.634664011513939206e-05, 1.740860627509455520e-06, -4.478273973360277918e-08, 1.230508591796118319e-09, -3.524863291385521415e-11, 1.039125035053218932e-12, -3.128351644871882975e-14, 9.595920188951384852e-16, -2.973109061952187159e-17,
+        -7.519307665026793153e+00, 4.217863266459526833e-03, -6.688563476204916446e-05, 1.426709848998945527e-06, -3.433315763515653698e-08, 8.825116955403376284e-10, -2.364893510438198889e-11, 6.521858342832355488e-13, -1.836764480099577235e-14, 5.268829396731819849e-16, -1.527110373660909659e-17,
+        -7.686690049636920818e+00, 7.529205788114935044e-03, -2.178751547417308732e-04, 8.477439079671254468e-06, -3.720887867755240258e-07, 1.744346974713017241e-08, -8.524901042046981758e-10, 4.287428244226519399e-11, -2.202054400311329303e-12, 1.158251522536968963e-13, -6.122720714788105741e-15,
+        -7.672440763978446654e+00, 6.748776586471755441e-03, -1.747244375633901870e-04, 6.082669608962329470e-06, -2.388712629676856896e-07, 1.001935989324130656e-08, -4.381142763007084444e-10, 1.971468917893507812e-11, -9.059694383731947599e-13, 4.257001949800564125e-14, -2.013379905611158950e-15,
+        -7.659596974247519618e+00, 6.115952414730691650e-03, -1.432531296235952831e-04, 4.511992751148263613e-06, -1.603118194542589968e-07, 6.083743602478358261e-09, -2.406848132985987036e-10, 9.799055116952216905e-12, -4.074172903227811478e-13, 1.730092244009496688e-14, -7.403108365455700497e-16,
+        -7.647904370549579056e+00, 5.592398328061372499e-03, -1.195937950826458717e-04, 3.439178219274812548e-06, -1.115673305839883495e-07, 3.865710029425775574e-09, -1.396351989873952373e-10, 5.190630336157184013e-12, -1.970445159528347828e-13, 7.633332449665662686e-15, -2.982233386425997755e-16,
+        -7.637172105341683448e+00, 5.152007718382406627e-03, -1.013574304221786512e-04, 2.681516758034229539e-06, -8.002854956900248205e-08, 2.551060628356532942e-09, -8.477560848514742768e-11, 2.899225312042276777e-12, -1.012539004897750744e-13, 3.606312822720734233e-15, -1.296198653627401091e-16,
+        -7.627253271394137890e+00, 4.776384294978033157e-03, -8.700349432759758004e-05, 2.131226329429436100e-06, -5.889316680810483169e-08, 1.738253323167769192e-09, -5.348553739721338687e-11, 1.693642083393815899e-12, -5.476783166337080782e-14, 1.805212918718733171e-15, -6.007683005584607494e-17,
+        -7.618032356856863530e+00, 4.452189949858038204e-03, -7.550230097542399619e-05, 1.721912573300760602e-06, -4.430035616483588779e-08, 1.217355690517234231e-09, -3.487415352193073099e-11, 1.028141054658807124e-12, -3.095425721538281953e-14, 9.495302634863625089e-16, -2.942037903875095896e-17,
+        -7.609416882818590189e+00, 4.169517209008791365e-03, -6.614437593312689535e-05, 1.411149053416520073e-06, -3.396257773629210981e-08, 8.730594089484678845e-10, -2.339718397642978345e-11, 6.452781397159641406e-13, -1.817393928058830463e-14, 5.213473347394043042e-16, -1.511119287903619715e-17,
+        -7.774919892375717012e+00, 7.446395497711564421e-03, -2.155550120326127589e-04, 8.388539034037161197e-06, -3.682257482025802017e-07, 1.726371092968803208e-08, -8.437565802607375196e-10, 4.243718247465221633e-11, -2.179697687602142639e-12, 1.146535207439626973e-13, -6.060984038166493386e-15,
+        -7.760827601363062378e+00, 6.674290804394053360e-03, -1.728575252679148591e-04, 6.018670736373126706e-06, -2.363831345726448457e-07, 9.915770994614158255e-09, -4.336113459327023471e-10, 1.951305011613881599e-11, -8.967418433357513701e-13, 4.213801708120172040e-14, -1.993013519830457397e-15,
+        -7.748125790778340516e+00, 6.048238411141567891e-03, -1.417178226274519958e-04, 4.464377402021876277e-06, -1.586370235202307720e-07, 6.020659184242508278e-09, -2.382038119470557545e-10, 9.698539566916861078e-12, -4.032555637149676228e-13, 1.712484279584456425e-14, -7.328005641625872625e-16,
+        -7.736562829857453139e+00, 5.530303150197606391e-03, -1.183084972105342937e-04, 3.402785150547531389e-06, -1.103986201542274739e-07, 3.825517503314231338e-09, -1.381919833738371991e-10, 5.137245056695956494e-12, -1.950264002923285718e-13, 7.555439207027591540e-15, -2.951899706131486722e-16,
+        -7.725949887459127474e+00, 5.094651453596763836e-03, -1.002653435267727457e-04, 2.653069931611408221e-06, -7.918813576357994673e-08, 2.524471313084472870e-09, -8.389725105737081619e-11, 2.869334187270594146e-12, -1.002143443464077027e-13, 3.569423438366026589e-15, -1.282982534069932481e-16,
+        -7.716141612619781931e+00, 4.723079938192903393e-03, -8.606385317830982649e-05, 2.108564722599827393e-06, -5.827328227732716213e-08, 1.720094417481563058e-09, -5.293011789812423734e-11, 1.676141137601406179e-12, -5.420427542254808593e-14, 1.786705757752079882e-15, -5.946291321948513891e-17,
+        -7.707023720153825863e+00, 4.402390701318223062e-03, -7.468508247943049234e-05, 1.703563672360540231e-06, -4.383307157045380581e-08, 1.204611404109297286e-09, -3.451123893834397026e-11, 1.017494622413442357e-12, -3.063507416271910837e-14, 9.397752988549180239e-16, -2.911911081122520962e-17,
+        -7.698504715439178803e+00, 4.122780646421630134e-03, -6.542697507997976517e-05, 1.396081286015564175e-06, -3.360362020479105232e-08, 8.639013482349823793e-10, -2.315322268415087182e-11, 6.385831372387478322e-13, -1.798617310753754582e-14, 5.159808401699912434e-16, -1.495615147931353292e-17,
+        -7.862189685200783984e+00, 7.366233855986005843e-03, -2.133067144924364277e-04, 8.302350572758105681e-06, -3.644793874703456878e-07, 1.708934226450646735e-08, -8.352834361866090280e-10, 4.201305242888884665e-11, -2.158001681151855762e-12, 1.135163911198974086e-13, -6.001059717707368049e-15,
+        -7.848249358934112685e+00, 6.602195482063697059e-03, -1.710486125110343304e-04, 5.956630209984793181e-06, -2.339703962914297626e-07, 9.815298087937228047e-09, -4.292430876463560750e-10, 1.931741296004862428e-11, -8.877878013424034047e-13, 4.171877581239888402e-14, -1.973246872069981308e-15,
+        -7.835684964021932153e+00, 5.982704182673720048e-03, -1.402303539019635655e-04, 4.418223301316780194e-06, -1.570131197607919562e-07, 5.959477787388054855e-09, -2.357972222071329158e-10, 9.601024376782970362e-12, -3.992175591782019930e-13, 1.695397908379356228e-14, -7.255120698157115924e-16,
+        -7.824247466748735391e+00, 5.470212439987049736e-03, -1.170633553316550914e-04, 3.367511891216156443e-06, -1.092655165299028573e-07, 3.786540590895150434e-09, -1.367921655057361613e-10, 5.085457415785088574e-12, -1.930684341429983647e-13, 7.479859271248702281e-15, -2.922464064472093316e-16,
+        -7.813749990423568548e+00, 5.039151420362145660e-03, -9.920746052241183148e-05, 2.625500539088544637e-06, -7.837338829894307438e-08, 2.498688108180646269e-09, -8.304536877392879433e-11, 2.840339717704268850e-12, -9.920584495716068559e-14, 3.533632187176685548e-15, -1.270158599277420145e-16,
+        -7.804048692411868160e+00, 4.671504765056351538e-03, -8.515370862252186993e-05, 2.086603679147350660e-06, -5.767237127099748214e-08, 1.702487254248128655e-09, -5.239147646994261734e-11, 1.659166322986717702e-12, -5.365759212476854416e-14, 1.768750721067214484e-15, -5.886725368987457194e-17,
+        -7.795030476318730805e+00, 4.354210490798346260e-03, -7.389357212293408970e-05, 1.685783198909810852e-06, -4.338011934269360579e-08, 1.192255138407524332e-09, -3.415930967743365381e-11, 1.007168905612025253e-12, -3.032546686628965809e-14, 9.303119428532004103e-16, -2.882682008160367709e-17,
+        -7.786604801354373606e+00, 4.077566680857538234e-03, -6.473218717340683583e-05, 1.381481214225907991e-06, -3.325569381345666864e-08, 8.550226561378881060e-10, -2.291666015650607551e-11, 6.320902003894126409e-13, -1.780405075485283102e-14, 5.107750715073692121e-16, -1.480573887035601264e-17,
+        -7.948529818124387525e+00, 7.288583331530140534e-03, -2.111266511836590082e-04, 8.218739430965232018e-06, -3.608439826923642936e-07, 1.692010129034900867e-08, -8.270580644258138178e-10, 4.160126721201004060e-11, -2.136934663458855133e-12, 1.124121128636501405e-13, -5.942861316195510276e-15,
+        -7.934736688313162034e+00, 6.532366084917484890e-03, -1.692947749601338885e-04, 5.896450757903553115e-06, -2.316293395185223372e-07, 9.717788979651370470e-09, -4.250029606635604443e-10, 1.912748756328800861e-11, -8.790941404733372733e-13, 4.131168336452714907e-14, -1.954051272308827880e-15,
+        -7.922305383694976832e+00, 5.919235832469628943e-03, -1.387883045189306744e-04, 4.373457663000837697e-06, -1.554375976694207386e-07, 5.900106204803709790e-09, -2.334614200535755640e-10, 9.506364102536597250e-12, -3.952973030165691628e-13, 1.678808033915752059e-14, -7.184347152313773014e-16,
+        -7.910989389602998578e+00, 5.412021176368482685e-03, -1.158563336567225953e-04, 3.333302518918877804e-06, -1.081662587497079750e-07, 3.748719602454568442e-09, -1.354336264852481393e-10, 5.035189772929797901e-12, -1.911677060435981878e-13, 7.406481059989846777e-15, -2.893883277178281718e-16,
+        -7.900603724934530447e+00, 4.985410121656506932e-03, -9.818204320497552948e-05, 2.598764658430066918e-06, -7.758303485225285880e-08, 2.473671339489642769e-09, -8.221866599359843025e-11, 2.812198228220844464e-12, -9.822689561115110300e-14, 3.498885979440165411e-15, -1.257707947096168252e-16,
+        -7.891006009843357205e+00, 4.621567742069412031e-03, -8.427155834243076830e-05, 2.065308053939306004e-06, -5.708949120149253851e-08, 1.685404620044308235e-09, -5.186879027009442933e-11, 1.642691957678094672e-12, -5.312696144678080962e-14, 1.751321059473989751e-15, -5.828896966147935615e-17,
+        -7.882084300749167660e+00, 4.307563900462055978e-03, -7.312645783231850195e-05, 1.668542578591873449e-06, -4.294078602662674386e-08, 1.180267716870595496e-09, -3.381782591639541884e-11, 9.971482182567394667e-13, -3.002496885633144916e-14, 9.211260398752443735e-16, -2.854307239664282698e-17,
+        -7.873748981766903299e+00, 4.033794821275848812e-03, -6.405885587734508628e-05, 1.367325282622242937e-06, -3.291824840466924642e-08, 8.464095000137193302e-10, -2.268713213877004587e-11, 6.257894279524325499e-13, -1.762729678431737310e-14, 5.057222122459583478e-16, -1.465973063738867202e-17,
+        -8.033969118970681222e+00, 7.213316153840452528e-03, -2.090114591501449016e-04, 8.137580429193064929e-06, -3.573141955102831259e-07, 1.675574301591868599e-08, -8.190686919929065026e-10, 4.120124292193525374e-11, -2.116466998990055338e-12, 1.113391434301299096e-13, -5.886308034125732627e-15,
+        -8.020318660336721805e+00, 6.464686945377029134e-03, -1.675932897345756931e-04, 5.838041710517846033e-06, -2.293565049819350484e-07, 9.623101636938407536e-09, -4.208848584738879452e-10, 1.894300295478631709e-11, -8.706485559884539172e-13, 4.091616758605636566e-14, -1.935399907304738260e-15,
+        -8.008016341751813982e+00, 5.857727596834666831e-03, -1.373894226523097659e-04, 4.330012654976869967e-06, -1.539081159844046690e-07, 5.842457468935447716e-09, -2.311930227228581752e-10, 9.414422938586006421e-12, -3.914892158665510091e-13, 1.662691210723286511e-14, -7.115585598989105640e-16,
+        -7.996818093402447758e+00, 5.355631857523125879e-03, -1.146855373897719680e-04, 3.300104927020477600e-06, -1.070992048621346022e-07, 3.711998853951661453e-09, -1.341143888220771562e-10, 4.986369645368571409e-12, -1.893214971907534048e-13, 7.335200349369133430e-15, -2.866116999297699092e-16,
+        -7.986540773790919090e+00, 4.933337058002799924e-03, -9.718747403587229899e-05, 2.572821371428902626e-06, -7.681588928363111200e-08, 2.449384001360110858e-09, -8.141593373662348960e-11, 2.784868951594381570e-12, -9.727608952295031479e-14, 3.465135234339602537e-15, -1.245612920934634272e-16,
+        -7.977043422551434837e+00, 4.573184384102137352e-03, -8.341600453671106988e-05, 2.044645110548558261e-06, -5.652376346389989865e-08, 1.668821135676411666e-09, -5.136129160826160861e-11, 1.626694073258449514e-12, -5.261161758194334780e-14, 1.734391795385840979e-15, -5.772723755517343235e-17,
+        -7.968215214709975847e+00, 4.262371669769992114e-03, -7.238251899923348151e-05, 1.651815199309247261e-06, -4.251440669175069484e-08, 1.168631258010575986e-09, -3.348628408508968425e-11, 9.874179229172646961e-13, -2.973314472314787543e-14, 9.122043736438330418e-16, -2.826746204535892125e-17,
+        -7.959967431783049996e+00, 3.991390390163235095e-03, -6.340590561647182165e-05, 1.353591556380950864e-06, -3.259077130762242173e-08, 8.380489830866328533e-10, -2.246429888271968899e-11, 6.196715817779881410e-13, -1.745565413087375536e-14, 5.008149654940329576e-16, -1.451791723888588358e-17,
+        -8.118534963165277674e+00, 7.140313442504612508e-03, -2.069580020175769213e-04, 8.058756700749153930e-06, -3.538850387821185137e-07, 1.659603845810620625e-08, -8.113043110198366116e-10, 4.081243343479649787e-11, -2.096570962342921685e-12, 1.102960393650689306e-13, -5.831324247289505765e-15,
+        -8.105022876507559815e+00, 6.399050469291131873e-03, -1.659416179687029725e-04, 5.781318437359919431e-06, -2.271486616751352397e-07, 9.531103335053332849e-09, -4.168830725890449579e-10, 1.876370574640356430e-11, -8.624395385464462244e-13, 4.053169318655998421e-14, -1.917267686214003798e-15,
+        -8.092845645357311213e+00, 5.798081115282064345e-03, -1.360316090748843313e-04, 4.287824975402152097e-06, -1.524224883499531809e-07, 5.786450326790326257e-09, -2.289888685236061500e-10, 9.325073914798585687e-12, -3.877880799708976705e-13, 1.647025507778171962e-14, -7.048743035247043504e-16,
+        -8.081761574109860291e+00, 5.300953824269152674e-03, -1.135492004604210286e-04, 3.267870497475865335e-06, -1.060628218181512685e-07, 3.676326329168837184e-09, -1.328326045716470722e-10, 4.938929277364020217e-12, -1.875272654120213097e-13, 7.265919663868759660e-15, -2.839127490476853998e-16,
+        -8.071589307575562700e+00, 4.882848096307307144e-03, -9.622224561898874511e-05, 2.547632505597063397e-06, -7.607084430044726818e-08, 2.425791531077021156e-09, -8.063604239919277064e-11, 2.758313785131950687e-12, -9.635211150176594028e-14, 3.432333588395163115e-15, -1.233857006572453840e-16,
+        -8.062189263644233606e+00, 4.526276162444816363e-03, -8.258574478651019833e-05, 2.024584313850029131e-06, -5.597436797870960220e-08, 1.652713100815840307e-09, -5.086826330035549730e-11, 1.611150271074475072e-12, -5.211084468597471031e-14, 1.717939575318151491e-15, -5.718128718466433026e-17,
+        -8.053451703388905258e+00, 4.218560137741218276e-03, -7.166061847143906231e-05, 1.635576241934389316e-06, -4.210036078522983882e-08, 1.157329065489255252e-09, -3.316421380632976162e-11, 9.779643426317310649e-13, -2.944958751751338600e-14, 9.035345888564314106e-16, -2.799960966857287403e-17,
+        -8.045288779553050773e+00, 3.950283995924747799e-03, -6.277233449137524599e-05, 1.340259581213238772e-06, -3.227278412906005222e-08, 8.299290648852813390e-10, -2.224784307463005034e-11, 6.137280309739478834e-13, -1.728888256216714028e-14, 4.960465105541810786e-16, -1.438010276742150087e-17,
+        -8.202253373823266358e+00, 7.069464429318757757e-03, -2.049633508019199927e-04, 7.982158997656265686e-06, -3.505518475262693544e-07, 1.644077332653374744e-08, -8.037546162165140784e-10, 4.043432733051812096e-11, -2.077220583376145425e-12, 1.092814482972890799e-13, -5.777839089744667216e-15,
+        -8.188875570566837681e+00, 6.335356427325844302e-03, -1.643373891793548623e-04, 5.726201841402622418e-06, -2.250027879179280314e-07, 9.441669890238213390e-09, -4.129922599159172711e-10, 1.858935869793320071e-11, -8.544563095321446934e-13, 4.015775874942416053e-14, -1.899631101405566984e-15,
+        -8.176819719817455479e+00, 5.740204778934843328e-03, -1.347129041598571671e-04, 4.246835472333205472e-06, -1.509786704300480362e-07, 5.732008767770106812e-09, -2.268459986678400363e-10, 9.238198173554886099e-12, -3.841890097015467987e-13, 1.631790385455086959e-14, -6.983732341644844366e-16,
+        -8.165846432853232528e+00, 5.247902656270769968e-03, -1.124456745321768979e-04, 3.236553807226516833e-06, -1.050556763903294585e-07, 3.641653375939391357e-09, -1.315865446633333004e-10, 4.892805252515036305e-12, -1.857826307338038016e-13, 7.198547726753606838e-15, -2.812879403456239809e-16,
+        -8.155776090005689483e+00, 4.833864906780422667e-03, -9.528495127465425420e-05, 2.523162402571769290e-06, -7.534686486820588835e-08, 2.402861606095275358e-09, -7.987793520042537447e-11, 2.732497071670539315e-12, -9.545373045139918226e-14, 3.400437632885110183e-15, -1.222424739196653081e-16,
+        -8.146470448141517551e+00, 4.480769976849568147e-03, -8.177956387562111316e-05, 2.005097143967067244e-06, -5.544053829104891646e-08, 1.637058354371031863e-09, -5.038903449054443540e-11, 1.596039592957640440e-12, -5.162397277776443729e-14, 1.701942537076558338e-15, -5.665039740291151941e-17,
+        -8.137820823361920475e+00, 4.176060745627885491e-03, -7.095969538192919957e-05, 1.619802528479837809e-06, -4.169806840882065951e-08, 1.146345529366968622e-09, -3.285117514498498793e-11, 9.687746816600483305e-13, -2.917391641130671694e-14, 8.951051206488376561e-16, -2.773916010627081345e-17,
+        -8.129740214703511825e+00, 3.910411062531763543e-03, -6.215720793659262162e-05, 1.327310257769444330e-06, -3.196383987248584314e-08, 8.220384897674099237e-10, -2.203746797275831978e-11, 6.079507017152164036e-13, -1.712675729255829835e-14, 4.914104638433358995e-16, -1.424610383400697427e-17,
+        -8.285149113161363488e+00, 7.000665761855439512e-03, -2.030247666623265863e-04, 7.907685065920789231e-06, -3.473102527416201391e-07, 1.628974683744763858e-08, -7.964099484488368228e-10, 4.006644511783705453e-11, -2.058391507369073928e-12, 1.082941017055516764e-13, -5.725786077011063041e-15,
+        -8.271901701234751769e+00, 6.273511320776599572e-03, -1.627783872218347620e-04, 5.672617904013219911e-06, -2.229160542973350803e-07, 9.354684968276270803e-09, -4.092074133300548363e-10, 1.841973942225997078e-11, -8.466887626772530242e-13, 3.979389403431915339e-14, -1.882468102737941694e-15,
+        -8.259963702535578989e+00, 5.684013147549219283e-03, -1.334314762067067618e-04, 4.206988801569772010e-06, -1.495747483047142265e-07, 5.679061598182211589e-09, -2.247616408889334172e-10, 9.153684317590053369e-12, -3.806874249581960714e-13, 1.616966584444455502e-14, -6.920471813850461720e-16,
+        -8.249097971003829244e+00, 5.196399631992474830e-03, -1.113734191332419539e-04, 3.206112364153001315e-06, -1.040764269977993146e-07, 3.607934432474981939e-09, -1.303745892805733476e-10, 4.847938144116544792e-12, -1.840853623604077937e-13, 7.132998964053952971e-15, -2.787339593121165172e-16,
+        -8.239126574053582175e+00, 4.786314459440530605e-03, -9.437427657832930512e-05, 2.499377709885753026e-06, -7.464298228011456624e-08, 2.380563961407515391e-09, -7.914062227663010378e-11, 2.707385402112143906e-12, -9.457979260508438409e-14, 3.369406676912359234e-15, -1.211301619491695193e-16,
+        -8.229912570070066380e+00, 4.436597683556926797e-03, -8.099632644953318563e-05, 1.986156929025231069e-06, -5.492155716079213347e-08, 1.621836148751396992e-09, -4.992297688676818953e-11, 1.581342404684093968e-12, -5.115037404261740005e-14, 1.686380189941805896e-15, -5.613389217336320711e-17,
+        -8.221348300604422121e+00, 4.134809592430388307e-03, -7.027875871485019020e-05, 1.604472385644766498e-06, -4.130698696939796989e-08, 1.135666037194428983e-09, -3.254675612983081953e-11, 9.598369540601984004e-13, -2.890577458822354706e-14, 8.869051309737395681e-16, -2.748578045539452267e-17,
+        -8.213347587212920686e+00, 3.871711409236534319e-03, -6.155965303142449298e-05, 1.314725728785025724e-06, -3.166352034695062181e-08, 8.143667225809394996e-10, -2.183289572980748724e-11, 6.023320320161283628e-13, -1.696906773368009752e-14, 4.869008436503951971e-16, -1.411574856167342111e-17,
+        -8.367245766134347562e+00, 6.933820878606040614e-03, -2.011396853704486537e-04, 7.835239082111124012e-06, -3.441561577741283601e-07, 1.614277064223280536e-08, -7.892612437412411970e-10, 3.970833672498856138e-11, -2.040060868520837840e-12, 1.073328083732108717e-13, -5.675102764997858000e-15,
+        -8.354125037038727442e+00, 6.213427812751655573e-03, -1.612625376475153912e-04, 5.620497274690314780e-06, -2.208858082724214412e-07, 9.270039460050361698e-09, -4.055238350860817746e-10, 1.825463921482113888e-11, -8.391274112652396718e-13, 3.943965753688150234e-14, -1.865757983790728038e-15,
+        -8.342301528930674337e+00, 5.629426426791788417e-03, -1.321856109351627522e-04, 4.168233118257392379e-06, -1.482089280009675539e-07, 5.627542057085659339e-09, -2.227331946428440705e-10, 9.071427820596735247e-12, -3.772790271176625684e-13, 1.602536025287635064e-14, -6.858884738906354275e-16,
+        -8.331540277100224046e+00, 5.146371244606450825e-03, -1.103309927771540193e-04, 3.176506369139857545e-06, -1.031238163324386853e-07, 3.575126780340105200e-09, -1.291952191728155202e-10, 4.804272199243318504e-12, -1.824333669044784279e-13, 7.069193056066716096e-15, -2.762476943794697088e-16,
+        -8.321664989805073631e+00, 4.740128572901356266e-03, -9.348899174975511055e-05, 2.476247193373706374e-06, -7.395828880911532421e-08, 2.358870224731694262e-09, -7.842317534881924977e-11, 2.682947437044523707e-12, -9.372921541183366242e-14, 3.339202533216078077e-15, -1.200474037762238786e-16,
+        -8.312539991195567524e+00, 4.393695672434367282e-03, -8.023497041380691936e-05, 1.967738694513204759e-06, -5.441675258663542884e-08, 1.607027036423277679e-09, -4.946950136236379386e-11, 1.567040290720143160e-12, -5.068945949218630985e-14, 1.671233306378481912e-15, -5.563113701800900285e-17,
+        -8.304058620043617722e+00, 4.094747036753487550e-03, -6.961688152061281808e-05, 1.589565521935793494e-06, -4.092660815969044053e-08, 1.125276893811901863e-09, -3.225057051684035185e-11, 9.511399191934230091e-13, -2.864482733836881567e-14, 8.789244511092596008e-16, -2.723915831424233902e-17,
+        -8.296135497738088560e+00, 3.834128874183922748e-03, -6.097885338577893117e-05, 1.302489277472341130e-06, -3.137143383172793459e-08, 8.069038906367634643e-10, -2.163386587910251234e-11, 5.968649308977300733e-13, -1.681561636596322515e-14, 4.825120382950993683e-16, -1.398887567591154450e-17,
+        -8.448565817087747121e+00, 6.868839447176294105e-03, -1.993057032983605386e-04, 7.764731144278071455e-06, -3.410857169430170961e-07, 1.599966785771864580e-08, -7.822999870996347333e-10, 3.935957922659242502e-11, -2.022207175314878042e-12, 1.063964484548913291e-13, -5.625730440736409472e-15,
+        -8.435568234037416957e+00, 6.155024216921309299e-03, -1.597878963011072745e-04, 5.569774900480185967e-06, -2.189095602551022741e-07, 9.187630916585263196e-09, -4.019371127482235836e-10, 1.809386199354743117e-11, -8.317633403015800463e-13, 3.909463427719268939e-14, -1.849481278733683394e-15,
+        -8.423856011141042543e+00, 5.576369998557070655e-03, -1.309737020119711181e-04, 4.130519798391745664e-06, -1.468795260299445769e-07, 5.577387468821186574e-09, -2.207582177153784612e-10, 8.991330493592959580e-12, -3.739597772506807222e-13, 1.588481717354213668e-14, -6.798899011209187964e-16,
+        -8.413196306455514417e+00, 5.097748767138469105e-03, -1.093170449583236279e-04, 3.147698501262789766e-06, -1.021966646953578649e-07, 3.543190321068711791e-09, -1.280470077947598347e-10, 4.761755052790077043e-12, -1.808246777294925873e-13, 7.007054531101608865e-15, -2.738262212753711416e-16,
+        -8.403414424906083369e+00, 4.695243509154714903e-03, -9.262794479360204284e-05, 2.453741567846983840e-06, -7.329193287613515663e-08, 2.337753767504829700e-09, -7.772472289903060904e-11, 2.659153745310964914e-12, -9.290098200161021064e-14, 3.309789324198980984e-15, -1.189929205197781368e-16,
+        -8.394375922253427547e+00, 4.352004487308118799e-03, -7.949450098557434995e-05, 1.949819027341612242e-06, -5.392549421468751508e-08, 1.592612767366348000e-09, -4.902805488256666704e-11, 1.553115958987516309e-12, -5.024067594122873337e-14, 1.656483823983741015e-15, -5.514153580038140092e-17,
+        -8.385975107525897698e+00, 4.055817339408096869e-03, -6.897319570437095409e-05, 1.575062916798689720e-06, -4.055645523153223961e-08, 1.115165248868227624e-09, -3.196225576667527971e-11, 9.426730233798015668e-13, -2.839076033390353601e-14, 8.711535296133458631e-16, -2.699900019271094395e-17,
+        -8.378127380276332303e+00, 3.797610976610670246e-03, -6.041404453376742888e-05, 1.290585235860865304e-06, -3.108721296761995283e-08, 7.996407312762757715e-10, -2.144013396597702312e-11, 5.915427414553522005e-13, -1.666621771756611412e-14, 4.782387773079576108e-16, -1.386533368117178721e-17,
+        -8.529130720125293053e+00, 6.805636858161698277e-03, -1.975205647530823454e-04, 7.696076811145186261e-06, -3.380953161762592903e-07, 1.586027218707106957e-08, -7.755181706267074372e-10, 3.901977478097301443e-11, -2.004810206459000970e-12, 1.054839680888609788e-13, -5.577613841480896653e-15,
+        -8.516252907153152307e+00, 6.098224037082048549e-03, -1.583526390167894931e-04, 5.520389690626840157e-06, -2.169849710029857724e-07, 9.107363037008287249e-09, -3.984430973641773738e-10, 1.793722333719991932e-11, -8.245881631081456429e-13, 3.875843379219274606e-14, -1.833619668680525675e-15,
+        -8.504648910238893578e+00, 5.524773998089207820e-03, -1.297942424928545701e-04, 4.093803186866344452e-06, -1.455849608181825850e-07, 5.528538928166813915e-09, -2.188344140807007849e-10, 8.913300000941061731e-12, -3.707258763584116310e-13, 1.574787676232974568e-14, -6.740446783891149197e-16,
+        -8.494087954185326694e+00, 5.050467861049462957e-03, -1.083303089226255323e-04, 3.119653723495430754e-06, -1.012938639644185976e-07, 3.512087373801458314e-09, -1.269286141816170510e-10, 4.720337468176403975e-12, -1.792574452825528963e-13, 6.946512396860906809e-15, -2.714667888201959375e-16,
+        -8.484396898345988092e+00, 4.651599608916315125e-03, -9.179005530567867048e-05, 2.431833343976005243e-06, -7.264311467683462088e-08, 2.317189569926795225e-09, -7.704444579920895739e-11, 2.635976657663061706e-12, -9.209413616582736159e-14, 3.281133305959270567e-15, -1.179655091500158265e-16,
+        -8.475442497437848388e+00, 4.311468484376637482e-03, -7.877398532333319164e-05, 1.932375952938743669e-06, -5.344719008850067224e-08, 1.578576196217102023e-09, -4.859811771990528841e-11, 1.539553154543250578e-12, -4.980350326636636961e-14, 1.642114756553981935e-15, -5.466452780690379784e-17,
+        -8.467120004968547775e+00, 4.017968341927800544e-03, -6.834688732205564739e-05, 1.560946720401271931e-06, -4.019608052880445942e-08, 1.105319031198891266e-09, -3.168147121261176127e-11, 9.344263470246828346e-13, -2.814327806581219185e-14, 8.635833851262736600e-16, -2.676503007022441598e-17,
+        -8.459345577942093186e+00, 3.762108613049200065e-03, -5.986450977667520629e-05, 1.278998901957767565e-06, -3.081051284941980705e-08, 7.925685444087757751e-10, -2.125147030823414991e-11, 5.863592073948534944e-13, -1.652069743886515662e-14, 4.740761052990992898e-16, -1.374498011398921692e-17,
+        -8.608960963808659272e+00, 6.744133768305723975e-03, -1.957821505077412562e-04, 7.629196684264889211e-06, -3.351815554364269403e-07, 1.572442712146172828e-08, -7.689082554670958297e-10, 3.868854875532881550e-11, -1.987850916269840481e-12, 1.045943744969086912e-13, -5.530700899159653649e-15,
+        -8.596199695742564373e+00, 6.042955551681045492e-03, -1.569550522904978771e-04, 5.472284212573768269e-06, -2.151098401809177412e-07, 9.029145203683002766e-09, -3.950378836399594085e-10, 1.778454961151513441e-11, -8.175939818673235471e-13, 3.843068831022572545e-14, -1.818155896516118375e-15,
+        -8.584701002596876407e+00, 5.474572932501619790e-03, -1.286458170772225714e-04, 4.058040369132047515e-06, -1.443237449351348958e-07, 5.480941014568385811e-09, -2.169596228755867773e-10, 8.837249420662568400e-12, -3.675737474115742111e-13, 1.561438848634913553e-14, -6.683464151819155236e-16,
+        -8.574236122308047214e+00, 5.004468223224046650e-03, -1.073695951260939755e-04, 3.092339106664447585e-06, -1.004143721235349390e-07, 3.481782491651093524e-09, -1.258387764805093144e-10, 4.679973101834406367e-12, -1.777299283108125889e-13, 6.887499805411370485e-15, -2.691668060151713697e-16,
+        -8.564633428239048385e+00, 4.609140962828474353e-03, -9.097430886988179240e-05, 2.410496689582779630e-06, -7.201108221643648093e-08, 2.297154098518810005e-09, -7.638157334343619659e-11, 2.613390133863057809e-12, -9.130777779755740306e-14, 3.253202708389936859e-15, -1.169640368191070052e-16,
+        -8.555760842819470469e+00, 4.272035524278836906e-03, -7.807254766990247806e-05, 1.915388823934603997e-06, -5.298128370292716308e-08, 1.564901198038918770e-09, -4.817920092701844858e-11, 1.526336581207015873e-12, -4.937745191635646424e-14, 1.628110113286620661e-15, -5.419958509451014529e-17,
+        -8.547514539374660103e+00, 3.981151176817458726e-03, -6.773719232669957505e-05, 1.547200162881928947e-06, -3.984506325140845855e-08, 1.095726889310953070e-09, -3.140789639812070243e-11, 9.263905566214131542e-13, -2.790210242434119612e-14, 8.562055634977810263e-16, -2.653698808544638370e-17,
+        -8.539811412545038394e+00, 3.727575783568999081e-03, -5.932957642452193185e-05, 1.267716464745486995e-06, -3.054100929729617815e-08, 7.856791494728730107e-10, -2.106765887157434910e-11, 5.813084426599712208e-13, -1.637889146213954177e-14, 4.700193582252592025e-16, -1.362768086446869401e-17,
+        -8.688076130736673619e+00, 6.684255687376041560e-03, -1.940884673983125745e-04, 7.564016028496022530e-06, -3.323412327449843160e-07, 1.559198521390812234e-08, -7.624631371763071025e-10, 3.836554801891207055e-11, -1.971311348507622368e-12, 1.037267315205647472e-13, -5.484942507523599053e-15,
+        -8.675428323963245703e+00, 5.989151438210250922e-03, -1.555935248211760596e-04, 5.425404415919584917e-06, -2.132820959656219712e-07, 8.952892059477043349e-09, -3.917177919030154358e-10, 1.763567717386099473e-11, -8.107733516990611918e-13, 3.811105108855415650e-14, -1.803073689307809716e-15,
+        -8.664032140974160967e+00, 5.425705335995525957e-03, -1.275270950861665616e-04, 4.023190963903328677e-06, -1.430944780311454652e-07, 5.434541532332091108e-09, -2.151318083705370236e-10, 8.763096844347936155e-12, -3.645000190015355799e-13, 1.548421044016101276e-14, -6.627890862886313417e-16,
+        -8.653660781493918819e+00, 4.959693266996503293e-03, -1.064337853058115925e-04, 3.065723669666319236e-06, -9.955720829310793902e-08, 3.452242294786519625e-09, -1.247763060679516542e-10, 4.640618288949765585e-12, -1.762404858678733110e-13, 6.829953748198363763e-15, -2.669238302853394275e-16,
+        -8.644144094188940031e+00, 4.567815114431863534e-03, -9.017975198058755879e-05, 2.389707303771642872e-06, -7.139512770849309454e-08, 2.277625194851233967e-09, -7.573537964035803558e-11, 2.591369641802590747e-12, -9.054105874263028342e-14, 3.225967589644173913e-15, -1.159874356999797308e-16,
+        -8.635351139284617616e+00, 4.233656693972812947e-03, -7.738936495170999335e-05, 1.898838219166869064e-06, -5.252725132887693489e-08, 1.551572591789635662e-09, -4.777084403930521500e-11, 1.513451830287500662e-12, -4.896206064711815243e-14, 1.614454825254069963e-15, -5.374621007636673033e-17,
+        -8.627178986311797360e+00, 3.945320005902750067e-03, -6.714339271509825143e-05, 1.533807472027578158e-06, -3.950300742519300859e-08, 1.086378137316036016e-09, -3.114122956588905624e-11, 9.185568611089537112e-13, -2.766697140779843253e-14, 8.490120987793676955e-16, -2.631462934381057324e-17,
+        -8.619545248577232144e+00, 3.693969344612557746e-03, -5.880861239192339577e-05, 1.256724936157032290e-06, -3.027839728764790792e-08, 7.789648463438841936e-10, -2.088849624762867146e-11, 5.763849038197477210e-13, -1.624064523735819891e-14, 4.660641417997127599e-16, -1.351330955887514949e-17,
+        -8.766494952489921388e+00, 6.625932603905816155e-03, -1.924376388711373359e-04, 7.500464426727055745e-06, -3.295713296364082614e-07, 1.546280741771693391e-08, -7.561761141560920696e-10, 3.805043938675258822e-11, -1.955174557785673775e-12, 1.028801555485852613e-13, -5.440292309652859662e-15,
+        -8.753957656431602175e+00, 5.936748433032265800e-03, -1.542665398271230424e-04, 5.379699381346746180e-06, -2.114997855831194994e-07, 8.878523122734699953e-09, -3.884793516664923832e-10, 1.749045164822111881e-11, -8.041192479038596860e-13, 3.779919489696360209e-14, -1.788357687517439502e-15,
+        -8.742661310825782905e+00, 5.378113457682444365e-03, -1.264368240854255574e-04, 3.989216934661805137e-06, -1.418958404105711011e-07, 5.389291274043435209e-09, -2.133490508332129043e-10, 8.690765012525222227e-12, -3.615015104355397415e-13, 1.535720872222838805e-14, -6.573670054666207090e-16,
+        -8.732381027974659204e+00, 4.916089833407794388e-03, -1.055218270965635827e-04, 3.039778234204033851e-06, -9.872144820835991241e-08, 3.423435318470276443e-09, -1.237400821918257297e-10, 4.602231848231523118e-12, -1.747875700277426363e-13, 6.773814777977188121e-15, -2.647355567575019290e-16,
+        -8.722948094755416548e+00, 4.527572791346228670e-03, -8.940548743335579218e-05, 2.369442302520447595e-06, -7.079458429885746288e-08, 2.258581974259080346e-09, -7.510518032788375382e-11, 2.569892047377651302e-12, -8.979317901867533254e-14, 3.199399703469726138e-15, -1.150346982803016262e-16,
+        -8.714232680522011165e+00, 4.196286055078157773e-03, -7.672366278470689558e-05, 1.882705851899035622e-06, -5.208459958009244035e-08, 1.538576070670870095e-09, -4.737261298316689689e-11, 1.500885315662054603e-12, -4.855689445798051375e-14, 1.601134678390711124e-15, -5.330393332090213547e-17,
+        -8.706132728386736019e+00, 3.910431783620110444e-03, -6.656481303112856817e-05, 1.520753798473288787e-06, -3.916954005583947407e-08, 1.077262705733049955e-09, -3.088118628228315230e-11, 9.109169721261332142e-13, -2.743763794625188385e-14, 8.419954776775781127e-16, -2.609772283058123885e-17,
+        -8.698566552147884323e+00, 3.661248785429821635e-03, -5.830102310953595539e-05, 1.246012089276390801e-06, -3.002238952637078181e-08, 7.724183797677005182e-10, -2.071379072374102984e-11, 5.715833649251472407e-13, -1.610581303607532228e-14, 4.622063118207324282e-16, -1.340174699694603776e-17,
+        -8.844235360373152943e+00, 6.569098645557551637e-03, -1.908278963804229528e-04, 7.438475465260216417e-06, -3.268689978936673811e-07, 1.533676248286198802e-08, -7.500408588412069524e-10, 3.774290819851766220e-11, -1.939424537781923614e-12, 1.020538117958995575e-13, -5.396706503755857414e-15,
+        -8.831805749612446022e+00, 5.885687022759940323e-03, -1.529726680550566663e-04, 5.335121091902608815e-06, -2.097610666818266578e-07, 8.805962436052504042e-09, -3.853192866297516079e-10, 1.734872726329157809e-11, -7.976250360479344856e-13, 3.749481063255962630e-14, -1.773993380322242622e-15,
+        -8.820606682283214539e+00, 5.331742978433476159e-03, -1.253738240846125822e-04, 3.956082417979862297e-06, -1.407265871737845297e-07, 5.345143804803712009e-09, -2.116095381920781478e-10, 8.620180981841262169e-12, -3.585752181280541756e-13, 1.523325686543603648e-14, -6.520748013844375637e-16,
+        -8.810415136068399988e+00, 4.873607929369481832e-03, -1.046327291349923841e-04, 3.014475292513253949e-06, -9.790622009874060994e-08, 3.395331874495330778e-09, -1.227290470835908901e-10, 4.564774903749785157e-12, -1.733697192336800414e-13, 6.719026754904987656e-15, -2.625998084674219401e-16,
+        -8.801063800484334010e+00, 4.488367661552044099e-03, -8.865067013385435955e-05, 2.349680114521923700e-06, -7.020882308079334768e-08, 2.240004733505259217e-09, -7.449032957675917393e-11, 2.548935514009305811e-12, -8.906338336424497832e-14, 3.173472378091769766e-15, -1.141048730650837763e-16,
+        -8.792423926524271849e+00, 4.159880415760676235e-03, -7.607471184333619259e-05, 1.866974486276184478e-06, -5.165286319654494808e-08, 1.525898138641263469e-09, -4.698409816849660935e-11, 1.488624214552550927e-12, -4.816154270841127353e-14, 1.588136252323452033e-15, -5.287231154227713746e-17,
+        -8.784394309189311301e+00, 3.876446042489239529e-03, -6.600081718744202819e-05, 1.508025147626512852e-06, -3.884430944737010877e-08, 1.068371096651869882e-09, -3.062749818316994281e-11, 9.034630677589046672e-13, -2.721386882826493594e-14, 8.351486071119787726e-16, -2.588605041860725157e-17,
+        -8.776893945344060199e+00, 3.629376025497456706e-03, -5.780624871715704010e-05, 1.235566402103372712e-06, -2.977271514954540371e-08, 7.660329069521278473e-10, -2.054336143494435748e-11, 5.668988945787115887e-13, -1.597425731639228097e-14, 4.584419562207670368e-16, -1.329288063829847538e-17,
+        -8.921314532341085624e+00, 6.513691770391921536e-03, -1.892575715470416493e-04, 7.377986446697058655e-06, -3.242315474340667313e-07, 1.521372640440849406e-08, -7.440513913591954912e-10, 3.744265701888729705e-11, -1.924046155569011917e-12, 1.012469108988091940e-13, -5.354143665432764356e-15,
+        -8.908989899333013440e+00, 5.835911163792690398e-03, -1.517105614094326643e-04, 5.291624224323728444e-06, -2.080641994556871920e-07, 8.735138245413624663e-09, -3.822345009694555433e-10, 1.721036624731323756e-11, -7.912844446042996333e-13, 3.719760605258162197e-14, -1.759967046432658987e-15,
+        -8.897885658205371584e+00, 5.286542753623017267e-03, -1.243369822522852428e-04, 3.923753566922850799e-06, -1.395855428696247681e-07, 5.302055265158168607e-09, -2.099115584189080274e-10, 8.551275820833973814e-12, -3.557183031574094885e-13, 1.511223531623588359e-14, -6.469073956140123211e-16,
+        -8.887780606725257826e+00, 4.832200489824682588e-03, -1.037655566000355591e-04, 2.989788886730285412e-06, -9.711070092712483464e-08, 3.367903924650107494e-09, -1.217422014928371123e-10, 4.528210722109548780e-12, -1.719855522177201071e-13, 6.665536614356588139e-15, -2.605145274027966976e-16,
+        -8.878508802911968090e+00, 4.450156112053143057e-03, -8.791450328098050163e-05, 2.330400386209727985e-06, -6.963725037120280271e-08, 2.221874866474277347e-09, -7.389021735353569371e-11, 2.528479410829665273e-12, -8.835095808457530625e-14, 3.148160405477498086e-15, -1.131970606467237572e-16,
+        -8.869942553020353060e+00, 4.124399123603750446e-03, -7.544182455427134941e-05, 1.851627861160582135e-06, -5.123160302207614123e-08, 1.513526052460670444e-09, -4.660491274658335628e-11, 1.476656413417445929e-12, -4.777561739690786675e-14, 1.575446864454449400e-15, -5.245092576296727366e-17,
+        -8.861981483126465164e+00, 3.843324698355928600e-03, -6.545080557190508625e-05, 1.495608317614568268e-06, -3.852698366824711833e-08, 1.059694342809419467e-09, -3.037991182867145346e-11, 8.961877594243590750e-13, -2.699544372019391624e-14, 8.284647845631098806e-16, -2.567940596119484357e-17,
+        -8.854545256443135059e+00, 3.598315230637305628e-03, -5.732376150868666808e-05, 1.225377006301648732e-06, -2.952911853834296035e-08, 7.598019679904479263e-10, -2.037703758970317900e-11, 5.623268349912142944e-13, -1.584584814276885726e-14, 4.547673786616597770e-16, -1.318660413295948261e-17,
+        -8.997748936452127921e+00, 6.459653485776602200e-03, -1.877250890004287674e-04, 7.318938127535024396e-06, -3.216564352296423001e-07, 1.509358191777360345e-08, -7.382020554167548389e-10, 3.714940444738083534e-11, -1.909025091457470740e-12, 1.004587057952279924e-13, -5.312564584782381332e-15,
+        -8.985526684772176864e+00, 5.787368027027219204e-03, -1.504789471381496799e-04, 5.249165958364679065e-06, -2.064075394416433490e-07, 8.665982706634748613e-09, -3.792220667923114347e-10, 1.707523827399339477e-11, -7.850915398962153292e-13, 3.690730461355835745e-14, -1.746265699864572363e-15,
+        -8.974514918656577578e+00, 5.242464579017786473e-03, -1.233252480936219834e-04, 3.892198407992722214e-06, -1.384715966066661604e-07, 5.259984190836110564e-09, -2.082534925581996278e-10, 8.483984331444192201e-12, -3.529280798718790269e-13, 1.499403095759745571e-14, -6.418599824692167190e-16,
+        -8.964494212455281996e+00, 4.791823161352950708e-03, -1.029194271445275477e-04, 2.965694498712639722e-06, -9.633411295233737055e-08, 3.341124964999721890e-09, -1.207786006018154242e-10, 4.492504563428035962e-12, -1.706337624340243207e-13, 6.613294154306255867e-15, -2.584777662991806647e-16,
+        -8.955299959910314911e+00, 4.412897047534510876e-03, -8.719623488540787328e-05, 2.311583895029235075e-06, -6.907930522145836613e-08, 2.204174787085716439e-09, -7.330426691686804724e-11, 2.508504228665566955e-12, -8.765522816438004900e-14, 3.123439939949243247e-15, -1.123104101060101309e-16,
+        -8.946805497210254643e+00, 4.089803877225115826e-03, -7.482435208121634138e-05, 1.836650620590574821e-06, -5.082040415652844365e-08, 1.501447768705988028e-09, -4.623469101677959636e-11, 1.464970458446955788e-12, -4.739875158584048577e-14, 1.563054518772431854e-15, -5.203937963134329520e-17,
+        -8.938911261522191509e+00, 3.811031873290323183e-03, -6.491421240918386517e-05, 1.483490842636905555e-06, -3.821724915002736301e-08, 1.051223970181907273e-09, -3.013818765587000755e-11, 8.890840615764414427e-13, -2.678215426878052751e-14, 8.219376709318604096e-16, -2.547759446162160372e-17,
+        -8.931537566356828606e+00, 3.568032645830578314e-03, -5.685306360272641740e-05, 1.215433640417547109e-06, -2.929135823649619701e-08, 7.537194588299275177e-10, -2.021465776197450175e-11, 5.578627828254450422e-13, -1.572046265518433251e-14, 4.511790835213222735e-16, -1.308281689161855469e-17,
+        -9.073554371158415677e+00, 6.406928592061315875e-03, -1.862289598344903237e-04, 7.261274478005574537e-06, -3.191412551595139170e-07, 1.497621803620491579e-08, -7.324874961940990399e-10, 3.686288402692925261e-11, -1.894347783814414624e-12, 9.968848886224538832e-14, -5.271932116912544425e-15,
+        -9.061432009238730600e+00, 5.740007765118522454e-03, -1.492766225182270696e-04, 5.207705802327792224e-06, -2.047895309244125951e-07, 8.598431616425706491e-09, -3.762792126351576151e-10, 1.694321995450767647e-11, -7.790407031179717744e-13, 3.662364440644006444e-14, -1.732877040184231964e-15,
+        -9.050510462130354483e+00, 5.199462977393006988e-03, -1.223376290436960429e-04, 3.861386710253607024e-06, -1.373836975775973723e-07, 5.218891347637602335e-09, -2.066338083396880671e-10, 8.418244793738030947e-12, -3.502020054424094004e-13, 1.487853667148460032e-14, -6.369280105108929869e-16,
+        -9.040572038962389811e+00, 4.752434104974009345e-03, -1.020935071781357113e-04, 2.942168949260725516e-06, -9.557572058273068758e-08, 3.314969919909865680e-09, -1.198373502823998797e-10, 4.457623544756637577e-12, -1.693131129556355746e-13, 6.562251840360485129e-15, -2.564876811153470898e-16,
+        -9.031453437701305376e+00, 4.376551706917794493e-03, -8.649515458934154929e-05, 2.293212470122163795e-06, -6.853445713937937756e-08, 2.186887858709597897e-09, -7.273193252404407699e-11, 2.488991503050934053e-12, -8.697555462142504348e-14, 3.099288405229570169e-15, -1.114441157117186076e-16,
+        -9.023029000134011213e+00, 4.056058554669238030e-03, -7.422168157102401818e-05, 1.822028250194154002e-06, -5.041887426488586635e-08, 1.489651895263455561e-09, -4.587308696718198791e-11, 1.453555510206629789e-12, -4.703059795787442595e-14, 1.550947858928252666e-15, -5.163729787906463695e-17,
+        -9.015199955319202374e+00, 3.779533734282273291e-03, -6.439050335135905934e-05, 1.471660941175685548e-06, -3.791480940527393268e-08, 1.042951963742459202e-09, -2.990209901973678611e-11, 8.821453639541871329e-13, -2.657380327882407091e-14, 8.155612656632523114e-16, -2.528043131177189231e-17,
+        -9.007887251646231164e+00, 3.538496442967726217e-03, -5.639368481568719001e-05, 1.205726607116904322e-06, -2.905920596003065447e-08, 7.477796065310345668e-10, -2.005606924299167405e-11, 5.535025716500530030e-13, -1.559798458277415347e-14, 4.476737621348108936e-16, -1.298142369169950567e-17
     };
 
     // ===== END COEFFICIENTS =====
 
     double average_, sigma_;
+    static constexpr double CONTINUATION_LIMIT = 1e-2;
+    static constexpr size_t GRID_CHAINS = 4;
+    static constexpr size_t TRANSFORM_BLOCK = 256;
+    static constexpr size_t MATRIX_BLOCK = 512;
+    static constexpr size_t STREAM_MIN = size_t(1) << 20;  // 8 MB of output
+    static constexpr size_t MAX_TILE = 2048;
     static constexpr double x_low_  = 0.02425;
     static constexpr double x_high_ = 0.97575;
+    static constexpr double LOG_X_LOW = -3.719338661598645;
+    static constexpr double TAIL_T_MAX = 12.5;
+    static constexpr double LOG_PHI_ASYMPTOTIC = -37.0;
+    static constexpr int LOG_PHI_TERMS = 8;
+    static constexpr double TWO_PI = 6.283185307179586476925286766559005768;
+
+    static constexpr double LOG_SQRT_2PI = 0.918938533204672741780329736405617639;
 };
 
 } // namespace quant
@@ -0,0 +1,244 @@
+#pragma once
+/*
+ * Inverse Student-t distribution with nu > 0 degrees of freedom.
+ *
+ * nu = 1, 2 and 4 have closed forms. Otherwise the seed is Hill's (1970,
+ * Algorithm 396) expansion about the normal quantile from
+ * InverseCumulativeNormal::standard_value(), or its power-law tail form,
+ * refined by Halley steps on the CDF residual. The CDF is the regularized
+ * incomplete beta I_x(nu/2, 1/2) by Lentz's continued fraction, with
+ * x = nu / (nu + t^2) carried through u = sqrt(nu) / |t| in the tails so
+ * t^2 never overflows. Work is done on p = min(x, 1 - x) and, on the tail
+ * side, on log F(t) = log p, so the iteration keeps its relative precision
+ * deep in either tail (about |log p| / nu ulp in t at the extreme).
+ *
+ * Once nu >= 1000 and z^2 <= nu / 200, the four-term Cornish-Fisher
+ * expansion in 1/nu is exact to rounding and replaces the iteration. That is
+ * also where the fraction is least accurate: x sits within t^2 / nu of 1, so
+ * the rounding of x costs about nu / t^2 ulp.
+ */
+
+#include "InverseCumulativeNormal.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace quant {
+
+class InverseCumulativeStudentT {
+  public:
+    // Throws std::invalid_argument unless nu > 0
+    explicit InverseCumulativeStudentT(double nu, double average = 0.0, double sigma = 1.0)
+    : nu_(nu), average_(average), sigma_(sigma), sqrt_nu_(sqrt(nu)),
+      log_beta_(log_beta(0.5 * nu)) {
+        if (!(nu > 0.0)) {
+            throw invalid_argument("InverseCumulativeStudentT: nu must be positive");
+        }
+        // Hill's constants depend on nu only
+        hill_a_ = 1.0 / (nu - 0.5);
+        hill_b_ = 48.0 / (hill_a_ * hill_a_);
+        hill_c_ = ((20700.0 * hill_a_ / hill_b_ - 98.0) * hill_a_ - 16.0) * hill_a_ + 96.36;
+        hill_d_ = ((94.5 / (hill_b_ + hill_c_) - 3.0) / hill_b_ + 1.0)
+                * sqrt(hill_a_ * HALF_PI) * nu;
+    }
+
+    inline double operator()(double x) const {
+        return average_ + sigma_ * standard_value(x);
+    }
+
+    inline void operator()(const double* in, double* out, size_t n) const {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = average_ + sigma_ * standard_value(in[i]);
+        }
+    }
+
+    // Standard t quantile (location 0, scale 1)
+    inline double standard_value(double x) const {
+        if (x != x) return x;
+        if (x <= 0.0) return -numeric_limits<double>::infinity();
+        if (x >= 1.0) return numeric_limits<double>::infinity();
+
+        const bool upper = x > 0.5;
+        const double p = upper ? 1.0 - x : x;
+        const double t = lower_value(p);
+        return upper ? -t : t;
+    }
+
+    double degrees_of_freedom() const { return nu_; }
+
+  private:
+    // Quantile at p <= 0.5, so t <= 0
+    inline double lower_value(double p) const {
+        if (nu_ == 1.0) return p > 0.25 ? -tan(PI * (0.5 - p)) : -1.0 / tan(PI * p);
+        if (nu_ == 2.0) return -(1.0 - 2.0 * p) / sqrt(2.0 * p * (1.0 - p));
+        if (nu_ == 4.0) {
+            // q = cos(theta/3) / cos(theta), sin(theta) = 1 - 2p, t = -2 sqrt(q - 1);
+            // q - 1 is formed from sines so there is no cancellation near
+            // p = 1/2; in the tail theta comes from cos(theta) = 2 sqrt(p (1 - p))
+            const double c = 2.0 * sqrt(p * (1.0 - p));
+            const double theta = p > 0.25 ? asin(1.0 - 2.0 * p) : HALF_PI - asin(c);
+            return -2.0 * sqrt(2.0 * sin(2.0 * theta / 3.0) * sin(theta / 3.0) / c);
+        }
+
+        const double z = InverseCumulativeNormal::standard_value(p);
+        if (nu_ >= CORNISH_FISHER_MIN_NU && z * z * CORNISH_FISHER_RATIO <= nu_) return cornish_fisher(z);
+
+        const double log_p = log(p);
+        double t = hill_seed(p, z);
+        for (int k = 0; k < MAX_HALLEY_STEPS && t > -numeric_limits<double>::infinity(); ++k) {
+            const double step = halley_step(t, p, log_p);
+            t -= step;
+            if (!(fabs(step) > HALLEY_TOLERANCE * fabs(t))) break;
+        }
+        return t;
+    }
+
+    // Hill (1970): expansion about the normal quantile z of p, or the
+    // power-law tail t ~ -sqrt(nu) (p nu B)^(-1/nu) refined for small y
+    inline double hill_seed(double p, double z) const {
+        // Hill's expansion is for nu >= 1; below that the leading tail term
+        // is used throughout, or z where it is closer to the centre
+        if (nu_ < 1.0) return min(z, -sqrt_nu_ * exp(-(log(p * nu_) + log_beta_) / nu_));
+
+        const double P = 2.0 * p;
+        double y = pow(hill_d_ * P, 2.0 / nu_);
+        if (!(y >= numeric_limits<double>::epsilon())) {
+            const double log_root = (log(hill_d_) + log(P)) / nu_;
+            if (log_root < -LN2 * 53) return -sqrt_nu_ * exp(-log_root);
+            y = exp(2.0 * log_root);
+        }
+
+        if ((nu_ < 2.1 && P > 0.5) || y > 0.05 + hill_a_) {
+            double c = hill_c_;
+            if (nu_ < 5.0) c += 0.3 * (nu_ - 4.5) * (z + 0.6);
+            c = (((0.05 * hill_d_ * z - 5.0) * z - 7.0) * z - 2.0) * z + hill_b_ + c;
+            const double w = z * z;
+            const double s = (((((0.4 * w + 6.3) * w + 36.0) * w + 94.5) / c - w - 3.0) / hill_b_ + 1.0) * z;
+            return -sqrt(nu_ * expm1(hill_a_ * s * s));
+        }
+
+        y = ((1.0 / (((nu_ + 6.0) / (nu_ * y) - 0.089 * hill_d_ - 0.822) * (nu_ + 2.0) * 3.0)
+              + 0.5 / (nu_ + 4.0)) * y - 1.0) * (nu_ + 1.0) / (nu_ + 2.0) + 1.0 / y;
+        return -sqrt(nu_ * y);
+    }
+
+    inline double cornish_fisher(double z) const {
+        const double z2 = z * z;
+        const double g1 = (z2 + 1.0) * z / 4.0;
+        const double g2 = ((5.0 * z2 + 16.0) * z2 + 3.0) * z / 96.0;
+        const double g3 = (((3.0 * z2 + 19.0) * z2 + 17.0) * z2 - 15.0) * z / 384.0;
+        const double g4 = ((((79.0 * z2 + 776.0) * z2 + 1482.0) * z2 - 1920.0) * z2 - 945.0) * z / 92160.0;
+        const double v = 1.0 / nu_;
+        return z + v * (g1 + v * (g2 + v * (g3 + v * g4)));
+    }
+
+    // Halley correction for t < 0, with F from the incomplete beta and
+    // f'/f = -(nu + 1) t / (nu + t^2) = -(nu + 1) y / t. On the tail side of
+    // the fraction the equation is log F(t) = log p, which is close to linear
+    // in log |t| on the power-law tail and never underflows; near the centre
+    // it is F(t) = p.
+    inline double halley_step(double t, double p, double log_p) const {
+        if (t == 0.0) {
+            const double f0 = exp(-log_beta_) / sqrt_nu_;
+            return (0.5 - p) / f0;
+        }
+
+        // x = nu / (nu + t^2), y = 1 - x, and their logs, without forming t^2
+        // when |t| > sqrt(nu)
+        double x = 0.0, y = 0.0, log_x = 0.0, log_y = 0.0;
+        if (-t > sqrt_nu_) {
+            const double u = sqrt_nu_ / -t;
+            const double u2 = u * u;
+            x = u2 / (1.0 + u2);
+            y = 1.0 / (1.0 + u2);
+            log_y = -log1p(u2);
+            log_x = 2.0 * log(u) + log_y;
+        } else {
+            const double w = t * t / nu_;
+            x = 1.0 / (1.0 + w);
+            y = w / (1.0 + w);
+            log_x = -log1p(w);
+            log_y = log(w) + log_x;
+        }
+
+        const double a = 0.5 * nu_;
+        const double log_front = a * log_x + 0.5 * log_y - log_beta_;
+        const double log_f = (a + 0.5) * log_x - log_beta_ - log(sqrt_nu_);
+        const double f_ratio = -(nu_ + 1.0) * y / t;
+
+        if (x < (a + 1.0) / (a + 2.5)) {
+            // g = log F - log p, g' = h = f / F, g'' = h (f'/f - h)
+            const double log_F = log_front + log(0.5 * beta_fraction(a, 0.5, x) / a);
+            const double g = log_F - log_p;
+            const double h = exp(log_f - log_F);
+            return (g / h) / (1.0 - 0.5 * g * (f_ratio - h) / h);
+        }
+
+        // F(t) - p as (1/2 - p) - (1/2 - F), where 1/2 - p is exact and
+        // 1/2 - F comes straight from the fraction
+        const double residual = (0.5 - p) - exp(log_front) * beta_fraction(0.5, a, y);
+        const double r = residual / exp(log_f);
+        return r / (1.0 - 0.5 * r * f_ratio);
+    }
+
+    // log B(a, 1/2) = log Gamma(a) + log sqrt(pi) - log Gamma(a + 1/2). For
+    // large a the two lgamma values cancel, so the difference is taken from
+    // its asymptotic series instead (below 2e-17 absolute from a = 20)
+    static inline double log_beta(double a) {
+        constexpr double LOG_SQRT_PI = 0.572364942924700087071713675676529356;
+        if (a < 20.0) return lgamma(a) + LOG_SQRT_PI - lgamma(a + 0.5);
+        const double v = 1.0 / (a * a);
+        const double series = (-1.0 / 8 + v * (1.0 / 192 + v * (-1.0 / 640 + v * (17.0 / 14336 - v * 31.0 / 18432)))) / a;
+        return LOG_SQRT_PI - 0.5 * log(a) - series;
+    }
+
+    // Continued fraction for I_x(a, b) (modified Lentz)
+    static inline double beta_fraction(double a, double b, double x) {
+        constexpr double TINY = 1e-300;
+        const double qab = a + b, qap = a + 1.0, qam = a - 1.0;
+        double c = 1.0;
+        double d = 1.0 - qab * x / qap;
+        if (fabs(d) < TINY) d = TINY;
+        d = 1.0 / d;
+        double h = d;
+        for (int m = 1; m <= MAX_FRACTION_TERMS; ++m) {
+            const int m2 = 2 * m;
+            double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+            d = 1.0 + aa * d;
+            if (fabs(d) < TINY) d = TINY;
+            c = 1.0 + aa / c;
+            if (fabs(c) < TINY) c = TINY;
+            d = 1.0 / d;
+            h *= d * c;
+            aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+            d = 1.0 + aa * d;
+            if (fabs(d) < TINY) d = TINY;
+            c = 1.0 + aa / c;
+            if (fabs(c) < TINY) c = TINY;
+            d = 1.0 / d;
+            const double delta = d * c;
+            h *= delta;
+            if (fabs(delta - 1.0) < FRACTION_TOLERANCE) break;
+        }
+        return h;
+    }
+
+    static constexpr double PI = 3.141592653589793238462643383279502884;
+    static constexpr double HALF_PI = 1.570796326794896619231321691639751442;
+    static constexpr double LN2 = 0.693147180559945309417232121458176568;
+    static constexpr double CORNISH_FISHER_MIN_NU = 1000.0;
+    static constexpr double CORNISH_FISHER_RATIO = 200.0;
+    static constexpr int MAX_HALLEY_STEPS = 8;
+    static constexpr double HALLEY_TOLERANCE = 1e-7;
+    static constexpr int MAX_FRACTION_TERMS = 4000;
+    static constexpr double FRACTION_TOLERANCE = 1e-16;
+
+    double nu_;
+    double average_;
+    double sigma_;
+    double sqrt_nu_;
+    double log_beta_;
+    double hill_a_, hill_b_, hill_c_, hill_d_;
+};
+
+} // namespace quant
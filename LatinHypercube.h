@@ -0,0 +1,140 @@
+#pragma once
+/*
+ * Latin hypercube and stratified normal samples.
+ *
+ * Sample i in dimension d lies in stratum pi_d(i) of n equal-probability strata,
+ * jittered uniformly inside the stratum and mapped through the batch probit.
+ * The stratified design instead stratifies dimension 0 alone (sample i in
+ * stratum i) and draws every other dimension as an independent uniform.
+ * pi_d is a keyed Feistel bijection on [0, n) evaluated per index, so no
+ * permutation array is ever stored: the design is produced tile by tile
+ * (tile_rows x tile_cols) and memory stays bounded for any n x dims.
+ * Jitter comes from a Philox substream per dimension, positioned by
+ * skip-ahead, so every tile is reproducible on its own.
+ */
+
+#include "InverseCumulativeNormal.h"
+#include "ParallelStreams.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace quant {
+
+// Stratified sampling of dimension 0 with proportional allocation: one
+// sample per stratum, in stratum order (a sorted sweep). The remaining
+// dimensions are plain Monte Carlo, one independent uniform per sample, so
+// unlike the Latin hypercube they are neither stratified nor tied to
+// dimension 0 or to each other.
+enum class SamplingDesign {
+    latin_hypercube,  // strata permuted independently per dimension
+    stratified        // sample i in stratum i of dimension 0, others independent
+};
+
+class LatinHypercubeSampler {
+  public:
+    LatinHypercubeSampler(size_t n_samples, size_t dims, uint64_t seed,
+                          SamplingDesign design = SamplingDesign::latin_hypercube)
+    : n_(n_samples), dims_(dims), seed_(seed), design_(design), keys_(dims) {
+        int bits = 2;
+        while (bits < 62 && (uint64_t(1) << bits) < n_) bits += 2;
+        half_bits_ = bits / 2;
+        half_mask_ = (uint64_t(1) << half_bits_) - 1;
+        for (size_t d = 0; d < dims_; ++d) {
+            Philox4x32 rng(seed_, d);
+            keys_[d] = rng();
+        }
+    }
+
+    size_t size() const { return n_; }
+    size_t dims() const { return dims_; }
+
+    // Stratum of sample i in dimension d; in dimensions 1.. of the stratified
+    // design, the stratum its independent uniform happened to fall in
+    inline uint64_t stratum(size_t i, size_t d) const {
+        if (design_ == SamplingDesign::stratified) {
+            if (d == 0) return i;
+            Philox4x32 rng(seed_, d);
+            rng.discard(1 + uint64_t(i));
+            return min<uint64_t>(n_ - 1, uint64_t(Philox4x32::to_uniform(rng()) * double(n_)));
+        }
+        uint64_t x = i;
+        do {
+            x = feistel(x, keys_[d]);
+        } while (x >= n_);
+        return x;
+    }
+
+    // Normals for samples [row_begin, row_end) x dimensions [col_begin, col_end),
+    // row-major with row length (col_end - col_begin)
+    void fill(size_t row_begin, size_t row_end, size_t col_begin, size_t col_end, double* tile) const {
+        const size_t rows = row_end - row_begin;
+        const size_t cols = col_end - col_begin;
+        const double inv_n = 1.0 / double(n_);
+        for (size_t d = col_begin; d < col_end; ++d) {
+            Philox4x32 rng(seed_, d);
+            rng.discard(1 + uint64_t(row_begin));
+            double* column = tile + (d - col_begin);
+            if (design_ == SamplingDesign::stratified && d > 0) {
+                for (size_t r = 0; r < rows; ++r) {
+                    column[r * cols] = Philox4x32::to_uniform(rng());
+                }
+                continue;
+            }
+            for (size_t r = 0; r < rows; ++r) {
+                const double jitter = Philox4x32::to_uniform(rng());
+                column[r * cols] = (double(stratum(row_begin + r, d)) + jitter) * inv_n;
+            }
+        }
+        icn_(tile, tile, rows * cols);
+    }
+
+    // Stream the full design through consumer(row_begin, rows, col_begin, cols, tile)
+    // one column block at a time; only one tile is ever allocated
+    template <class Consumer>
+    void generate(Consumer&& consumer, size_t tile_rows = 4096, size_t tile_cols = 64) const {
+        tile_rows = max<size_t>(1, tile_rows);
+        tile_cols = max<size_t>(1, tile_cols);
+        vector<double> tile(min(tile_rows, n_) * min(tile_cols, dims_));
+        for (size_t c0 = 0; c0 < dims_; c0 += tile_cols) {
+            const size_t c1 = min(dims_, c0 + tile_cols);
+            for (size_t r0 = 0; r0 < n_; r0 += tile_rows) {
+                const size_t r1 = min(n_, r0 + tile_rows);
+                fill(r0, r1, c0, c1, tile.data());
+                consumer(r0, r1 - r0, c0, c1 - c0, static_cast<const double*>(tile.data()));
+            }
+        }
+    }
+
+  private:
+    // Balanced Feistel network on [0, 4^half_bits_); cycle-walking restricts it to [0, n)
+    inline uint64_t feistel(uint64_t x, uint64_t key) const {
+        uint64_t left = x >> half_bits_;
+        uint64_t right = x & half_mask_;
+        for (int round = 0; round < FEISTEL_ROUNDS; ++round) {
+            const uint64_t f = mix(right ^ (key + uint64_t(round) * 0x9E3779B97F4A7C15ull)) & half_mask_;
+            const uint64_t next = left ^ f;
+            left = right;
+            right = next;
+        }
+        return (left << half_bits_) | right;
+    }
+
+    static inline uint64_t mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    static constexpr int FEISTEL_ROUNDS = 6;
+
+    size_t n_, dims_;
+    uint64_t seed_;
+    SamplingDesign design_;
+    vector<uint64_t> keys_;
+    int half_bits_;
+    uint64_t half_mask_;
+    InverseCumulativeNormal icn_;
+};
+
+} // namespace quant
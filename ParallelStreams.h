@@ -0,0 +1,325 @@
+#pragma once
+/*
+ * Reproducible parallel normal streams for Monte Carlo.
+ *
+ * Every path owns a fixed position in its generator: path p always consumes
+ * the same random words (pseudo-random) or the same Sobol point (quasi-random),
+ * whichever thread happens to produce it. Work is split into fixed-size blocks
+ * of paths; each block positions its own generator by skip-ahead and writes
+ * into a disjoint slice of the output, so no generator state is shared and the
+ * result is bit-identical for any thread count.
+ */
+
+#include "InverseCumulativeNormal.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace quant {
+
+// Philox4x32-10 counter-based generator (Salmon et al., SC'11).
+// The 128-bit counter is split into a 64-bit position and a 64-bit stream id,
+// so skip-ahead is O(1) and every stream id is an independent substream.
+class Philox4x32 {
+  public:
+    explicit Philox4x32(uint64_t seed = 0, uint64_t stream = 0)
+    : key_{uint32_t(seed), uint32_t(seed >> 32)}, stream_(stream), position_(0) {}
+
+    // Next 64 random bits
+    inline uint64_t operator()() {
+        if ((position_ & 1) == 0) {
+            generate_block(position_ >> 1);
+        }
+        const uint64_t word = (position_ & 1) ? block_[1] : block_[0];
+        ++position_;
+        return word;
+    }
+
+    // Skip the next n 64-bit outputs
+    inline void discard(uint64_t n) {
+        position_ += n;
+        if (position_ & 1) {
+            generate_block(position_ >> 1);
+        }
+    }
+
+    // Map 64 random bits to a uniform in (0, 1); never returns 0 or 1.
+    // 52 bits keep k + 1/2 exact, so the range is [2^-53, 1 - 2^-53]
+    // (53 bits would round 2^53 - 1/2 up to 2^53 and return 1).
+    static inline double to_uniform(uint64_t bits) {
+        return (double(bits >> 12) + 0.5) * 0x1p-52;
+    }
+
+    // Raw Philox4x32-10 bijection, exposed for known-answer tests
+    static inline void bijection(const uint32_t in[4], const uint32_t key[2], uint32_t out[4]) {
+        uint32_t c0 = in[0], c1 = in[1], c2 = in[2], c3 = in[3];
+        uint32_t k0 = key[0], k1 = key[1];
+        for (int round = 0; round < 10; ++round) {
+            if (round > 0) {
+                k0 += W0;
+                k1 += W1;
+            }
+            const uint64_t p0 = uint64_t(M0) * c0;
+            const uint64_t p1 = uint64_t(M1) * c2;
+            const uint32_t n0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+            const uint32_t n2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+            c1 = uint32_t(p1);
+            c3 = uint32_t(p0);
+            c0 = n0;
+            c2 = n2;
+        }
+        out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+    }
+
+  private:
+    inline void generate_block(uint64_t counter) {
+        const uint32_t in[4] = {
+            uint32_t(counter), uint32_t(counter >> 32),
+            uint32_t(stream_), uint32_t(stream_ >> 32)
+        };
+        uint32_t out[4];
+        bijection(in, key_, out);
+        block_[0] = uint64_t(out[0]) | (uint64_t(out[1]) << 32);
+        block_[1] = uint64_t(out[2]) | (uint64_t(out[3]) << 32);
+    }
+
+    static constexpr uint32_t M0 = 0xD2511F53u;
+    static constexpr uint32_t M1 = 0xCD9E8D57u;
+    static constexpr uint32_t W0 = 0x9E3779B9u;
+    static constexpr uint32_t W1 = 0xBB67AE85u;
+
+    uint32_t key_[2];
+    uint64_t stream_;
+    uint64_t position_;
+    uint64_t block_[2] = {0, 0};
+};
+
+// Sobol low-discrepancy sequence with 32-bit resolution and Gray-code ordering.
+// Direction numbers are the first 64 dimensions of Joe & Kuo (new-joe-kuo-6.21201).
+// More than MAX_DIMS dimensions throws std::invalid_argument. The 32-bit
+// resolution also caps the sequence at 2^32 points: skip_to() or next()
+// beyond point 2^32 - 1 throws std::out_of_range.
+class SobolSequence {
+  public:
+    static constexpr size_t MAX_DIMS = 64;
+    static constexpr int BITS = 32;
+    static constexpr uint64_t MAX_POINTS = uint64_t(1) << BITS;
+
+    explicit SobolSequence(size_t dims)
+    : dims_(checked_dims(dims)), direction_(dims_ * BITS), state_(dims_, 0), index_(0) {
+        for (size_t d = 0; d < dims_; ++d) {
+            uint32_t* v = &direction_[d * BITS];
+            if (d == 0) {
+                for (int k = 0; k < BITS; ++k) {
+                    v[k] = uint32_t(1) << (BITS - 1 - k);
+                }
+                continue;
+            }
+            const uint32_t poly = DIRECTIONS[d].poly;
+            int s = 0;
+            while ((poly >> (s + 1)) != 0) ++s;
+
+            uint32_t m[BITS];
+            for (int k = 0; k < s; ++k) {
+                m[k] = DIRECTIONS[d].m[k];
+            }
+            for (int k = s; k < BITS; ++k) {
+                uint32_t value = m[k - s] ^ (m[k - s] << s);
+                for (int j = 1; j < s; ++j) {
+                    if ((poly >> (s - j)) & 1) {
+                        value ^= m[k - j] << j;
+                    }
+                }
+                m[k] = value;
+            }
+            for (int k = 0; k < BITS; ++k) {
+                v[k] = m[k] << (BITS - 1 - k);
+            }
+        }
+    }
+
+    size_t dims() const { return dims_; }
+
+    // Position the sequence so that the next point returned is point `index`
+    void skip_to(uint64_t index) {
+        if (index >= MAX_POINTS) throw out_of_range("SobolSequence: index beyond 2^32 - 1");
+        const uint64_t gray = index ^ (index >> 1);
+        for (size_t d = 0; d < dims_; ++d) {
+            uint32_t x = 0;
+            for (int k = 0; k < BITS; ++k) {
+                if ((gray >> k) & 1) {
+                    x ^= direction_[d * BITS + k];
+                }
+            }
+            state_[d] = x;
+        }
+        index_ = index;
+    }
+
+    // Write the current point as uniforms in [0, 1) and advance by one
+    void next(double* point) {
+        if (index_ >= MAX_POINTS) throw out_of_range("SobolSequence: index beyond 2^32 - 1");
+        for (size_t d = 0; d < dims_; ++d) {
+            point[d] = state_[d] * 0x1p-32;
+        }
+        // The last point, 2^32 - 1, has no successor: c would be 32
+        int c = 0;
+        while ((index_ >> c) & 1) ++c;
+        if (c < BITS) {
+            for (size_t d = 0; d < dims_; ++d) {
+                state_[d] ^= direction_[d * BITS + c];
+            }
+        }
+        ++index_;
+    }
+
+    static size_t checked_dims(size_t dims) {
+        if (dims > MAX_DIMS) throw invalid_argument("SobolSequence: more than 64 dimensions");
+        return dims;
+    }
+
+  private:
+    struct Direction {
+        uint32_t poly;
+        uint32_t m[9];
+    };
+
+    static constexpr Direction DIRECTIONS[MAX_DIMS] = {
+        {1, {1}}, {3, {1}},
+        {7, {1, 3}}, {11, {1, 3, 1}},
+        {13, {1, 1, 1}}, {19, {1, 1, 3, 3}},
+        {25, {1, 3, 5, 13}}, {37, {1, 1, 5, 5, 17}},
+        {41, {1, 1, 5, 5, 5}}, {47, {1, 1, 7, 11, 19}},
+        {55, {1, 1, 5, 1, 1}}, {59, {1, 1, 1, 3, 11}},
+        {61, {1, 3, 5, 5, 31}}, {67, {1, 3, 3, 9, 7, 49}},
+        {91, {1, 1, 1, 15, 21, 21}}, {97, {1, 3, 1, 13, 27, 49}},
+        {103, {1, 1, 1, 15, 7, 5}}, {109, {1, 3, 1, 15, 13, 25}},
+        {115, {1, 1, 5, 5, 19, 61}}, {131, {1, 3, 7, 11, 23, 15, 103}},
+        {137, {1, 3, 7, 13, 13, 15, 69}}, {143, {1, 1, 3, 13, 7, 35, 63}},
+        {145, {1, 3, 5, 9, 1, 25, 53}}, {157, {1, 3, 1, 13, 9, 35, 107}},
+        {167, {1, 3, 1, 5, 27, 61, 31}}, {171, {1, 1, 5, 11, 19, 41, 61}},
+        {185, {1, 3, 5, 3, 3, 13, 69}}, {191, {1, 1, 7, 13, 1, 19, 1}},
+        {193, {1, 3, 7, 5, 13, 19, 59}}, {203, {1, 1, 3, 9, 25, 29, 41}},
+        {211, {1, 3, 5, 13, 23, 1, 55}}, {213, {1, 3, 7, 3, 13, 59, 17}},
+        {229, {1, 3, 1, 3, 5, 53, 69}}, {239, {1, 1, 5, 5, 23, 33, 13}},
+        {241, {1, 1, 7, 7, 1, 61, 123}}, {247, {1, 1, 7, 9, 13, 61, 49}},
+        {253, {1, 3, 3, 5, 3, 55, 33}}, {285, {1, 3, 1, 15, 31, 13, 49, 245}},
+        {299, {1, 3, 5, 15, 31, 59, 63, 97}}, {301, {1, 3, 1, 11, 11, 11, 77, 249}},
+        {333, {1, 3, 1, 11, 27, 43, 71, 9}}, {351, {1, 1, 7, 15, 21, 11, 81, 45}},
+        {355, {1, 3, 7, 3, 25, 31, 65, 79}}, {357, {1, 3, 1, 1, 19, 11, 3, 205}},
+        {361, {1, 1, 5, 9, 19, 21, 29, 157}}, {369, {1, 3, 7, 11, 1, 33, 89, 185}},
+        {391, {1, 3, 3, 3, 15, 9, 79, 71}}, {397, {1, 3, 7, 11, 15, 39, 119, 27}},
+        {425, {1, 1, 3, 1, 11, 31, 97, 225}}, {451, {1, 1, 1, 3, 23, 43, 57, 177}},
+        {463, {1, 3, 7, 7, 17, 17, 37, 71}}, {487, {1, 3, 1, 5, 27, 63, 123, 213}},
+        {501, {1, 1, 3, 5, 11, 43, 53, 133}}, {529, {1, 3, 5, 5, 29, 17, 47, 173, 479}},
+        {539, {1, 3, 3, 11, 3, 1, 109, 9, 69}}, {545, {1, 1, 1, 5, 17, 39, 23, 5, 343}},
+        {557, {1, 3, 1, 5, 25, 15, 31, 103, 499}}, {563, {1, 1, 1, 11, 11, 17, 63, 105, 183}},
+        {601, {1, 1, 5, 11, 9, 29, 97, 231, 363}}, {607, {1, 1, 5, 15, 19, 45, 41, 7, 383}},
+        {617, {1, 3, 7, 7, 31, 19, 83, 137, 221}}, {623, {1, 1, 1, 3, 23, 15, 111, 223, 83}},
+        {631, {1, 1, 5, 13, 31, 15, 55, 25, 161}}, {637, {1, 1, 3, 13, 25, 47, 39, 87, 257}},
+    };
+
+    size_t dims_;
+    vector<uint32_t> direction_;
+    vector<uint32_t> state_;
+    uint64_t index_;
+};
+
+// How pseudo-random paths are laid out over Philox counter space
+enum class StreamLayout {
+    block_split,   // one stream; path p starts at word p * dims via skip-ahead
+    per_path       // stream id = path index; each path is its own substream
+};
+
+// Standard normals from Philox, `dims` draws per path
+class PseudoRandomNormals {
+  public:
+    PseudoRandomNormals(uint64_t seed, size_t dims, StreamLayout layout = StreamLayout::block_split)
+    : seed_(seed), dims_(dims), layout_(layout) {}
+
+    size_t dims() const { return dims_; }
+
+    // Normals for paths [begin, end) into out[(end - begin) * dims].
+    // Raw words go straight through from_bits(), keeping all 64 bits.
+    void fill(size_t begin, size_t end, double* out) const {
+        if (layout_ == StreamLayout::block_split) {
+            Philox4x32 rng(seed_);
+            rng.discard(uint64_t(begin) * dims_);
+            for (size_t i = 0, n = (end - begin) * dims_; i < n; ++i) {
+                out[i] = icn_.from_bits(rng());
+            }
+        } else {
+            for (size_t p = begin; p < end; ++p) {
+                Philox4x32 rng(seed_, p);
+                double* row = out + (p - begin) * dims_;
+                for (size_t d = 0; d < dims_; ++d) {
+                    row[d] = icn_.from_bits(rng());
+                }
+            }
+        }
+    }
+
+  private:
+    uint64_t seed_;
+    size_t dims_;
+    StreamLayout layout_;
+    InverseCumulativeNormal icn_;
+};
+
+// Standard normals from Sobol points; path p is point p + 1 (the origin is
+// skipped), so at most 2^32 - 1 paths and SobolSequence::MAX_DIMS dimensions
+class SobolNormals {
+  public:
+    explicit SobolNormals(size_t dims) : dims_(SobolSequence::checked_dims(dims)) {}
+
+    size_t dims() const { return dims_; }
+
+    void fill(size_t begin, size_t end, double* out) const {
+        SobolSequence sobol(dims_);
+        sobol.skip_to(uint64_t(begin) + 1);
+        for (size_t p = begin; p < end; ++p) {
+            sobol.next(out + (p - begin) * dims_);
+        }
+        icn_(out, out, (end - begin) * dims_);
+    }
+
+  private:
+    size_t dims_;
+    InverseCumulativeNormal icn_;
+};
+
+// Fill out[n_paths * dims] from `stream` on n_threads threads.
+// Blocks of block_paths paths are dealt round-robin; the output does not
+// depend on n_threads or on scheduling.
+template <class Stream>
+void generate_normals(const Stream& stream, size_t n_paths, double* out,
+                      unsigned n_threads, size_t block_paths = 1024) {
+    const size_t dims = stream.dims();
+    const size_t n_blocks = (n_paths + block_paths - 1) / block_paths;
+    n_threads = max(1u, n_threads);
+
+    auto worker = [&](unsigned t) {
+        for (size_t b = t; b < n_blocks; b += n_threads) {
+            const size_t begin = b * block_paths;
+            const size_t end = min(n_paths, begin + block_paths);
+            stream.fill(begin, end, out + begin * dims);
+        }
+    };
+
+    if (n_threads == 1) {
+        worker(0);
+        return;
+    }
+    vector<thread> pool;
+    pool.reserve(n_threads);
+    for (unsigned t = 0; t < n_threads; ++t) {
+        pool.emplace_back(worker, t);
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+}
+
+} // namespace quant
@@ -0,0 +1,69 @@
+#pragma once
+/*
+ * Derivatives of the probit for algorithmic differentiation.
+ *
+ * dz/dx = sigma / phi(z_std) is known in closed form, so there is nothing to
+ * gain from differentiating through the initial guess, the Halley steps and
+ * erfc. Forward mode propagates a Dual through one multiply; reverse mode
+ * records the partial once during the forward sweep (ProbitNode, or the
+ * dz_dx array of the batch form) and the adjoint x_bar += z_bar * dz/dx is
+ * one multiply per element. The partial comes from quantile_derivatives(),
+ * which reuses the density of the last Halley step instead of another exp.
+ */
+
+#include "InverseCumulativeNormal.h"
+
+namespace quant {
+
+// Forward-mode dual number: value and directional derivative
+struct Dual {
+    double value;
+    double tangent;
+};
+
+QUANT_CONSTEXPR Dual quantile(const InverseCumulativeNormal& icn, Dual x) {
+    double z = 0.0, dz_dx = 0.0;
+    icn.quantile_derivatives(x.value, &z, &dz_dx);
+    return {z, dz_dx * x.tangent};
+}
+
+inline void quantile(const InverseCumulativeNormal& icn, const Dual* in, Dual* out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = quantile(icn, in[i]);
+    }
+}
+
+// A single tape entry for z = icn(x): record() runs the forward evaluation
+// and keeps dz/dx, adjoint() maps z_bar to the contribution to x_bar
+class ProbitNode {
+  public:
+    QUANT_CONSTEXPR double record(const InverseCumulativeNormal& icn, double x) {
+        double z = 0.0;
+        icn.quantile_derivatives(x, &z, &dz_dx_);
+        return z;
+    }
+
+    QUANT_CONSTEXPR double adjoint(double z_bar) const {
+        return z_bar * dz_dx_;
+    }
+
+    QUANT_CONSTEXPR double partial() const { return dz_dx_; }
+
+  private:
+    double dz_dx_ = 0.0;
+};
+
+// Forward sweep of the batch: z[i] = icn(x[i]) and the partials dz_dx[i]
+inline void quantile_forward(const InverseCumulativeNormal& icn, const double* x,
+                             double* z, double* dz_dx, size_t n) {
+    icn.quantile_derivatives(x, z, dz_dx, nullptr, n);
+}
+
+// Reverse sweep: x_bar[i] += z_bar[i] * dz_dx[i]
+inline void quantile_adjoint(const double* z_bar, const double* dz_dx, double* x_bar, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        x_bar[i] = detail::fmadd(z_bar[i], dz_dx[i], x_bar[i]);
+    }
+}
+
+} // namespace quant
@@ -0,0 +1,95 @@
+#pragma once
+/*
+ * Deduplicating batch and result cache for repeated probabilities.
+ *
+ * Inputs are keyed on their bit pattern in an open-addressing table (linear
+ * probing, multiplicative hash), so each distinct x is evaluated once and its
+ * quantile is copied to every repeat. The table holds at most max_entries
+ * values; once it is full, new values are still evaluated but no longer
+ * stored, so a mostly distinct batch degrades to the plain per-element cost
+ * plus one probe.
+ *
+ * QuantileCache persists across calls; deduplicated() uses a fresh table
+ * sized for a single batch.
+ */
+
+#include "InverseCumulativeNormal.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace quant {
+
+class QuantileCache {
+  public:
+    explicit QuantileCache(const InverseCumulativeNormal& icn = InverseCumulativeNormal(),
+                           size_t max_entries = 1024)
+    : icn_(icn), max_entries_(max<size_t>(1, max_entries)), size_(0) {
+        int bits = 1;
+        while ((size_t(1) << bits) < 2 * max_entries_) ++bits;
+        shift_ = 64 - bits;
+        keys_.assign(size_t(1) << bits, EMPTY);
+        values_.resize(size_t(1) << bits);
+    }
+
+    inline double operator()(double x) {
+        const uint64_t key = bits_of(x);
+        if (key == EMPTY) return icn_(x);
+
+        size_t slot = key * HASH_MULTIPLIER >> shift_;
+        const size_t mask = keys_.size() - 1;
+        while (keys_[slot] != EMPTY) {
+            if (keys_[slot] == key) return values_[slot];
+            slot = (slot + 1) & mask;
+        }
+
+        const double z = icn_(x);
+        if (size_ < max_entries_) {
+            keys_[slot] = key;
+            values_[slot] = z;
+            ++size_;
+        }
+        return z;
+    }
+
+    inline void operator()(const double* in, double* out, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = (*this)(in[i]);
+        }
+    }
+
+    size_t size() const { return size_; }
+
+    void clear() {
+        fill(keys_.begin(), keys_.end(), EMPTY);
+        size_ = 0;
+    }
+
+  private:
+    static inline uint64_t bits_of(double x) {
+        uint64_t bits;
+        memcpy(&bits, &x, sizeof bits);
+        return bits;
+    }
+
+    // A NaN pattern; an input with exactly these bits bypasses the table
+    static constexpr uint64_t EMPTY = ~uint64_t(0);
+    static constexpr uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+    InverseCumulativeNormal icn_;
+    size_t max_entries_, size_;
+    int shift_;
+    vector<uint64_t> keys_;
+    vector<double> values_;
+};
+
+// Batch that evaluates each distinct input once, with a table used for this
+// call only. At most max_distinct values are remembered.
+inline void deduplicated(const InverseCumulativeNormal& icn, const double* in, double* out,
+                         size_t n, size_t max_distinct = 4096) {
+    QuantileCache cache(icn, min(n, max_distinct));
+    cache(in, out, n);
+}
+
+} // namespace quant
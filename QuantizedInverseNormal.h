@@ -0,0 +1,174 @@
+#pragma once
+/*
+ * Table-driven probit for quantized uniforms.
+ *
+ * A b-bit code c stands for the uniform u = (c + 1/2) / 2^b.
+ *   16-bit: exact 65,536-entry table of standard_value(u).
+ *   32-bit: the code is folded to m = min(u, 1 - u) and indexed by the
+ *           position of its leading one (octave) plus the next SEGMENT_BITS
+ *           bits; each cell stores the degree-POLY_DEGREE Taylor expansion of
+ *           Phi^{-1} about its centre. The 2^SEGMENT_BITS smallest codes,
+ *           where cells would be a single code wide, are tabulated exactly.
+ *
+ * Cells are relatively narrow in m at every depth, so the expansion stays
+ * accurate all the way to the extreme codes (|z| ~ 6.4). Tables are built once,
+ * on first use, from InverseCumulativeNormal::standard_value().
+ */
+
+#include "InverseCumulativeNormal.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace quant {
+
+class QuantizedInverseCumulativeNormal {
+  public:
+    explicit QuantizedInverseCumulativeNormal(double average = 0.0, double sigma = 1.0)
+    : average_(average), sigma_(sigma) {}
+
+    inline double from_u16(uint16_t code) const {
+        return average_ + sigma_ * standard_from_u16(code);
+    }
+
+    inline void from_u16(const uint16_t* in, double* out, size_t n) const {
+        const double* table = table16().data();
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = average_ + sigma_ * table[in[i]];
+        }
+    }
+
+    inline double from_u32(uint32_t code) const {
+        return average_ + sigma_ * standard_from_u32(code);
+    }
+
+    inline void from_u32(const uint32_t* in, double* out, size_t n) const {
+        const Table32& table = table32();
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = average_ + sigma_ * evaluate(table, in[i]);
+        }
+    }
+
+    static inline double standard_from_u16(uint16_t code) {
+        return table16()[code];
+    }
+
+    static inline double standard_from_u32(uint32_t code) {
+        return evaluate(table32(), code);
+    }
+
+  private:
+    static constexpr int SEGMENT_BITS = 6;
+    static constexpr int POLY_DEGREE = 6;
+    static constexpr int COEFFS = POLY_DEGREE + 1;
+    static constexpr uint32_t CELLS = uint32_t(1) << SEGMENT_BITS;
+    static constexpr int OCTAVES = 31 - SEGMENT_BITS;
+
+    struct Table32 {
+        vector<double> exact;   // folded codes k < CELLS
+        vector<double> coeffs;  // OCTAVES * CELLS cells, COEFFS each
+    };
+
+    static inline double evaluate(const Table32& table, uint32_t code) {
+        const bool upper = (code >> 31) != 0;
+        const uint32_t k = upper ? ~code : code;
+
+        double z;
+        if (k < CELLS) {
+            z = table.exact[k];
+        } else {
+            const int e = 31 - leading_zeros(k);
+            const int shift = e - SEGMENT_BITS;
+            const uint32_t row = (uint32_t(shift) << SEGMENT_BITS) | ((k >> shift) & (CELLS - 1));
+            const double* c = &table.coeffs[size_t(row) * COEFFS];
+
+            // Position within the cell, scaled to [-1, 1]
+            const uint32_t start = (k >> shift) << shift;
+            const double half_width = double(uint32_t(1) << shift) * 0.5;
+            const double s = (double(k - start) + 0.5 - half_width) / half_width;
+
+            z = c[POLY_DEGREE];
+            for (int i = POLY_DEGREE - 1; i >= 0; --i) {
+                z = z * s + c[i];
+            }
+        }
+
+        return upper ? -z : z;
+    }
+
+    static const vector<double>& table16() {
+        static const vector<double> table = [] {
+            vector<double> t(65536);
+            for (uint32_t c = 0; c < 65536; ++c) {
+                t[c] = InverseCumulativeNormal::standard_value((c + 0.5) * 0x1p-16);
+            }
+            return t;
+        }();
+        return table;
+    }
+
+    static const Table32& table32() {
+        static const Table32 table = [] {
+            Table32 t;
+            t.exact.resize(CELLS);
+            for (uint32_t k = 0; k < CELLS; ++k) {
+                t.exact[k] = InverseCumulativeNormal::standard_value((k + 0.5) * 0x1p-32);
+            }
+
+            // Taylor coefficients in s = (m - m_c) / H, from the derivatives of
+            // z = Phi^{-1}(m) with p = phi(z): z' = 1/p, z'' = z/p^2,
+            // z''' = (1 + 2z^2)/p^3, z^(4) = z(7 + 6z^2)/p^4,
+            // z^(5) = (7 + 46z^2 + 24z^4)/p^5, z^(6) = z(127 + 326z^2 + 120z^4)/p^6
+            constexpr double INV_SQRT_2PI = 0.398942280401432677939946059934381868475858631164934657;
+            t.coeffs.resize(size_t(OCTAVES) * CELLS * COEFFS);
+            for (int shift = 0; shift < OCTAVES; ++shift) {
+                for (uint32_t j = 0; j < CELLS; ++j) {
+                    const double width = double(uint32_t(1) << shift);
+                    const double start = double((CELLS + j) << shift);
+                    const double m_c = (start + 0.5 * width) * 0x1p-32;
+                    const double H = 0.5 * width * 0x1p-32;
+
+                    const double z = InverseCumulativeNormal::standard_value(m_c);
+                    const double z2 = z * z;
+                    const double q = H / (INV_SQRT_2PI * exp(-0.5 * z2));
+                    const double derivs[COEFFS] = {
+                        z,
+                        1.0,
+                        z,
+                        1.0 + 2.0 * z2,
+                        z * (7.0 + 6.0 * z2),
+                        7.0 + z2 * (46.0 + 24.0 * z2),
+                        z * (127.0 + z2 * (326.0 + 120.0 * z2))
+                    };
+
+                    double* c = &t.coeffs[((size_t(shift) << SEGMENT_BITS) + j) * COEFFS];
+                    double q_pow = 1.0, factorial = 1.0;
+                    for (int i = 0; i < COEFFS; ++i) {
+                        c[i] = (i == 0) ? z : derivs[i] * q_pow / factorial;
+                        q_pow *= q;
+                        factorial *= (i + 1);
+                    }
+                }
+            }
+            return t;
+        }();
+        return table;
+    }
+
+    static inline int leading_zeros(uint32_t k) {
+#if defined(__GNUC__)
+        return k ? __builtin_clz(k) : 32;
+#else
+        int n = 32;
+        while (k) {
+            k >>= 1;
+            --n;
+        }
+        return n;
+#endif
+    }
+
+    double average_, sigma_;
+};
+
+} // namespace quant
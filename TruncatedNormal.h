@@ -0,0 +1,135 @@
+#pragma once
+/*
+ * Inverse-transform sampler for the normal truncated to [lower, upper].
+ *
+ * The textbook Phi^{-1}(Phi(a) + u (Phi(b) - Phi(a))) loses everything once
+ * both bounds sit in the upper tail, where Phi rounds to 1, or deep in the
+ * lower tail, where Phi underflows. Here the interval is first reflected so
+ * that most of it lies below zero (Phi^{-1} is odd), and the CDF values are
+ * handled through log Phi from CumulativeNormal, which is finite everywhere.
+ * With d = log Phi(a) - log Phi(b) <= 0 the target probability is
+ *
+ *   log p = log Phi(b) + log(e^d + u (1 - e^d)),
+ *
+ * with e^d and 1 - e^d = -expm1(d) both formed without cancellation. While
+ * Phi(a) and Phi(b) are normal doubles, p is formed directly as a sum of
+ * two non-negative terms and goes through the rational probit kernel;
+ * otherwise from_log_p() inverts log p, refining on the log-ratio residual
+ * like the expm1 tail residual of the untruncated kernel. Which path is used
+ * depends on the bounds only, so a batch never branches per element.
+ */
+
+#include "CumulativeNormal.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace quant {
+
+class TruncatedNormal {
+  public:
+    // Throws std::invalid_argument unless lower < upper (an empty, inverted
+    // or NaN interval has no mass to sample)
+    explicit TruncatedNormal(double lower, double upper, double average = 0.0, double sigma = 1.0)
+    : lower_(lower), upper_(upper), average_(average), sigma_(sigma) {
+        if (!(lower < upper)) throw invalid_argument("TruncatedNormal: lower must be below upper");
+        double a = (lower - average) / sigma;
+        double b = (upper - average) / sigma;
+        reflected_ = a + b > 0.0;
+        if (reflected_) {
+            const double t = a;
+            a = -b;
+            b = -t;
+        }
+        alpha_ = a;
+        beta_ = b;
+
+        log_lower_ = CumulativeNormal::standard_log_value(a);
+        log_upper_ = CumulativeNormal::standard_log_value(b);
+        log_ratio_ = log_lower_ - log_upper_;
+        if (!(log_ratio_ <= 0.0)) log_ratio_ = 0.0;   // both bounds overflow to -inf
+        expm1_ratio_ = expm1(log_ratio_);
+        log_width_ = log(-expm1_ratio_);
+
+        direct_ = log_upper_ > LOG_DIRECT_MIN && (log_lower_ > LOG_DIRECT_MIN || a == -numeric_limits<double>::infinity());
+        if (direct_) {
+            // Phi(b) - Phi(a) from the difference when there is no
+            // cancellation, from Phi(b) (1 - e^d) when there is
+            p_lower_ = CumulativeNormal::standard_value(a);
+            const double p_upper = CumulativeNormal::standard_value(b);
+            p_width_ = p_lower_ < 0.5 * p_upper ? p_upper - p_lower_ : -p_upper * expm1_ratio_;
+        }
+    }
+
+    inline double operator()(double u) const {
+        const double z = direct_ ? InverseCumulativeNormal::standard_value(direct_probability(u))
+                                 : InverseCumulativeNormal::standard_from_log_p(log_probability(u));
+        return finish(z);
+    }
+
+    // Probabilities for a block go through the untruncated batch kernels
+    inline void operator()(const double* in, double* out, size_t n) const {
+        const InverseCumulativeNormal normal;
+        double t[BLOCK];
+        for (size_t b = 0; b < n; b += BLOCK) {
+            const size_t m = min(n - b, BLOCK);
+            if (direct_) {
+                for (size_t i = 0; i < m; ++i) t[i] = direct_probability(in[b + i]);
+                normal(t, out + b, m);
+            } else {
+                for (size_t i = 0; i < m; ++i) t[i] = log_probability(in[b + i]);
+                normal.from_log_p(t, out + b, m);
+            }
+            for (size_t i = 0; i < m; ++i) out[b + i] = finish(out[b + i]);
+        }
+    }
+
+    // log(Phi(b) - Phi(a)) in standard units: the log of the probability
+    // mass of the interval, finite however deep in a tail it lies
+    double log_mass() const { return log_upper_ + log_width_; }
+
+    double lower() const { return lower_; }
+    double upper() const { return upper_; }
+
+  private:
+    inline double direct_probability(double u) const {
+        return p_lower_ + u * p_width_;
+    }
+
+    // log Phi(b) + log(e^d + u (1 - e^d)); for e^d > 1/2 the sum is
+    // 1 + (1 - u) expm1(d), for e^d <= 1/2 it is added in log space
+    inline double log_probability(double u) const {
+        if (log_ratio_ > -LN2) return log_upper_ + log1p((1.0 - u) * expm1_ratio_);
+        const double s = log(u) + log_width_;
+        const double hi = max(s, log_ratio_);
+        const double lo = min(s, log_ratio_);
+        if (hi == -numeric_limits<double>::infinity()) return hi;
+        return log_upper_ + hi + log1p(exp(lo - hi));
+    }
+
+    // Clamp rounding back into the interval, undo the reflection and scale
+    inline double finish(double z) const {
+        z = min(max(z, alpha_), beta_);
+        return average_ + sigma_ * (reflected_ ? -z : z);
+    }
+
+    static constexpr size_t BLOCK = 256;
+    static constexpr double LOG_DIRECT_MIN = -690.0;   // Phi >= ~1e-300
+    static constexpr double LN2 = 0.693147180559945309417232121458176568;
+
+    double lower_;
+    double upper_;
+    double average_;
+    double sigma_;
+    bool reflected_;
+    bool direct_;
+    double alpha_, beta_;             // standardized bounds after reflection
+    double log_lower_, log_upper_;    // log Phi(alpha), log Phi(beta)
+    double log_ratio_;                // d = log Phi(alpha) - log Phi(beta)
+    double expm1_ratio_;              // e^d - 1
+    double log_width_;                // log(1 - e^d)
+    double p_lower_ = 0.0;            // Phi(alpha), direct path only
+    double p_width_ = 0.0;            // Phi(beta) - Phi(alpha), direct path only
+};
+
+} // namespace quant
@@ -124,12 +124,66 @@ def fit_tail_region(p=8, q=8, num_samples=400):
         'num_samples': len(x_tail)
     }
 
+def fit_segmented_region(segment_bits=3, degree=10, octaves=63, samples_per_cell=8):
+    """Fit the segmented engine: one polynomial per dyadic cell of m in (0, 0.5).
+
+    Octave o covers m in [2^-(o+2), 2^-(o+1)) and is split into 2^segment_bits
+    equal cells by the leading mantissa bits. Each cell is interpolated at
+    Chebyshev nodes of s in [-1, 1] (m = centre + half_width * s) and solved
+    for monomial coefficients in extended precision, so rounding the result
+    to double costs about one ulp.
+    """
+    import mpmath
+    mpmath.mp.dps = 40
+
+    def probit(m):
+        # ndtri is good to about an ulp; Newton steps at 40 digits finish it
+        z = mpmath.mpf(float(norm.ppf(float(m))))
+        for _ in range(3):
+            z -= (mpmath.ncdf(z) - m) / mpmath.npdf(z)
+        return z
+
+    cells = 1 << segment_bits
+    nodes = [mpmath.cos(mpmath.pi * (k + mpmath.mpf(1) / 2) / (degree + 1))
+             for k in range(degree + 1)]
+    V = mpmath.matrix([[t ** k for k in range(degree + 1)] for t in nodes])
+    rng = np.random.default_rng(2024)
+
+    coeffs = []
+    errors = []
+    for o in range(octaves):
+        base = mpmath.ldexp(1, -(o + 2))
+        for j in range(cells):
+            half = base / (2 * cells)
+            centre = base + (2 * j + 1) * half
+            z = mpmath.matrix([probit(centre + half * t) for t in nodes])
+            c = [float(v) for v in mpmath.lu_solve(V, z)]
+            coeffs.append(c)
+
+            for s in np.concatenate([rng.uniform(-1.0, 1.0, samples_per_cell), [-1.0]]):
+                approx = 0.0
+                for ck in reversed(c):
+                    approx = approx * s + ck
+                exact = probit(centre + half * mpmath.mpf(s))
+                errors.append(float(abs(approx - exact) / max(1, abs(exact))))
+
+    return {
+        'coefficients': coeffs,
+        'segment_bits': segment_bits,
+        'degree': degree,
+        'octaves': octaves,
+        'max_error': float(np.max(errors)),
+        'mean_error': float(np.mean(errors)),
+        'num_samples': len(errors)
+    }
+
 def export_coefficients(output_path='coefficients.json'):
     """Export all coefficients to JSON"""
     
     print("Deriving coefficients...")
     central = fit_central_region(m=6, n=6)
     tail = fit_tail_region(p=8, q=8)
+    segmented = fit_segmented_region(segment_bits=3, degree=10)
     
     # Create complete configuration
     config = {
@@ -140,6 +194,7 @@ def export_coefficients(output_path='coefficients.json'):
         },
         'central_region': central,
         'tail_region': tail,
+        'segmented_region': segmented,
         'parameters': {
             'x_low': 0.02425,
             'x_high': 1.0 - 0.02425
@@ -158,6 +213,9 @@ def export_coefficients(output_path='coefficients.json'):
     print(f"\n   Tail region: p={tail['degree_p']}, q={tail['degree_q']}")
     print(f"     - Max error: {tail['max_error']:.6e}")
     print(f"     - Mean error: {tail['mean_error']:.6e}")
+    print(f"\n   Segmented: {segmented['octaves']} octaves x {1 << segmented['segment_bits']} cells, degree {segmented['degree']}")
+    print(f"     - Max error: {segmented['max_error']:.6e}")
+    print(f"     - Mean error: {segmented['mean_error']:.6e}")
     
     return config
 
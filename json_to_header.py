@@ -4,7 +4,10 @@ Generate C++ header from JSON coefficients.
 This creates a clean separation: Python computes, JSON stores, C++ uses.
 """
 
+import decimal
 import json
+import math
+import struct
 import sys
 
 def generate_header_from_json(json_path='coefficients.json', output_path='InverseCumulativeNormal.h'):
@@ -16,12 +19,45 @@ def generate_header_from_json(json_path='coefficients.json', output_path='Invers
     
     central = config['central_region']
     tail = config['tail_region']
+    segmented = config['segmented_region']
     params = config['parameters']
     metadata = config['metadata']
     
     # Format coefficient arrays
     def format_array(coeffs):
         return ',\n        '.join(f'{c:.18e}' for c in coeffs)
+
+    # Reduction table for detail::log_core(): cell i of f in [0.6875, 1.375)
+    # starts at bit pattern LOG_OFFSET + (i << (52 - LOG_TABLE_BITS)). 1/c is
+    # rounded to 32 significant bits so f_hi / c is exact; cells touching 1
+    # use c = 1.
+    LOG_TABLE_BITS = 7
+    LOG_OFFSET = 0x3fe6000000000000
+    def bits_to_double(b):
+        return struct.unpack('<d', struct.pack('<Q', b))[0]
+    log_table = []
+    for i in range(1 << LOG_TABLE_BITS):
+        lo = bits_to_double(LOG_OFFSET + (i << (52 - LOG_TABLE_BITS)))
+        hi = bits_to_double(LOG_OFFSET + ((i + 1) << (52 - LOG_TABLE_BITS)))
+        if lo <= 1.0 <= hi:
+            inv_c = 1.0
+        else:
+            mantissa, exponent = math.frexp(1.0 / (0.5 * (lo + hi)))
+            inv_c = math.ldexp(round(mantissa * 2**32), exponent - 32)
+        log_table.append([inv_c, -math.log(inv_c)])
+
+    # Tables for detail::exp_split(), computed in 50-digit decimal arithmetic
+    decimal.getcontext().prec = 50
+    ln2 = decimal.Decimal(2).ln()
+    exp_table = [float(decimal.Decimal(2) ** (decimal.Decimal(j) / 128)) for j in range(128)]
+    mantissa, exponent = math.frexp(float(ln2 / 128))
+    exp_step_hi = math.ldexp(round(mantissa * 2**32), exponent - 32)
+    exp_step_lo = float(ln2 / 128 - decimal.Decimal(exp_step_hi))
+    exp_inv_step = float(128 / ln2)
+
+    # One cell per line for the segmented table
+    def format_table(rows):
+        return ',\n        '.join(', '.join(f'{c:.18e}' for c in row) for row in rows)
     
     # Generate header
     header = f'''#pragma once
@@ -37,25 +73,398 @@ def generate_header_from_json(json_path='coefficients.json', output_path='Invers
  *   Max error: {tail['max_error']:.6e}
  *   Mean error: {tail['mean_error']:.6e}
  * 
+ * Segmented region: {segmented['octaves']} octaves x {1 << segmented['segment_bits']} cells, degree {segmented['degree']}
+ *   Max error: {segmented['max_error']:.6e}
+ *   Mean error: {segmented['mean_error']:.6e}
+ * 
+ * Constant evaluation is opt-in: define QUANT_ENABLE_CONSTEXPR before the
+ * include to make the scalar quantiles constexpr. That mode replaces the
+ * <cmath> calls with the portable functions in detail, needs GCC 11+ or
+ * Clang 9+ (__builtin_bit_cast), and is bit-identical between compile time
+ * and run time only with -ffp-contract=off. Without it the header is plain
+ * C++17 and the runtime path uses <cmath>.
+ * 
  * DO NOT EDIT THIS FILE MANUALLY
  * Regenerate using: python3 export_coefficients.py && python3 json_to_header.py
  */
 
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <algorithm>
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+// Specifier for every function a constant-evaluated quantile can reach
+#if defined(QUANT_ENABLE_CONSTEXPR)
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 11
+#error "QUANT_ENABLE_CONSTEXPR needs __builtin_bit_cast (GCC 11+, Clang 9+)"
+#endif
+#define QUANT_CONSTEXPR constexpr
+#else
+#define QUANT_CONSTEXPR inline
+#endif
 
 using namespace std;
 
 namespace quant {{
 
+// Portable elementary functions (*_portable): table lookups and multiply-adds
+// only, so they can be evaluated at compile time and give the same bits on
+// every target that does not contract multiply-adds on its own. All are
+// accurate to within a few ulp; erfc follows fdlibm. The quantile code calls
+// the dispatchers exp, expm1, log, erfc and sqrt at the end of the namespace,
+// which pick these under QUANT_ENABLE_CONSTEXPR and <cmath> otherwise.
+namespace detail {{
+
+inline constexpr double LN2 = 0.693147180559945309417232121458176568;
+inline constexpr double LN2_HI = 6.93147180369123816490e-01;   // 32 bits, e * LN2_HI exact
+inline constexpr double LN2_LO = 1.90821492927058770002e-10;
+inline constexpr double EXP_OVERFLOW = 7.09782712893383973096e+02;
+inline constexpr double EXP_UNDERFLOW = -7.45133219101941108420e+02;
+inline constexpr double EXP_NORMAL_MIN = -707.0;   // exp() of anything above is normal
+
+// exp_split(): 2^(j/128), ln2 / 128 in two parts (the high part has 32 bits,
+// so n * EXP_STEP_HI is exact), and 1, 1/2!, ..., 1/5! for (exp(r) - 1) / r
+inline constexpr int EXP_TABLE_BITS = 7;
+inline constexpr int EXP_TABLE_SIZE = 1 << EXP_TABLE_BITS;
+inline constexpr double EXP_INV_STEP = {exp_inv_step!r};
+inline constexpr double EXP_STEP_HI = {exp_step_hi!r};
+inline constexpr double EXP_STEP_LO = {exp_step_lo!r};
+inline constexpr double EXP_TABLE[EXP_TABLE_SIZE] = {{
+    {format_array(exp_table).replace(chr(10) + '        ', chr(10) + '    ')}
+}};
+inline constexpr int EXP_DEGREE = 5;
+inline constexpr double EXP_TAYLOR[EXP_DEGREE] = {{
+    1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120
+}};
+
+// log_core(): {{1/c, log c}} per cell, and log1p(r) / r = 1 - r/2 + r^2/3 - ...
+inline constexpr int LOG_TABLE_BITS = {LOG_TABLE_BITS};
+inline constexpr uint64_t LOG_OFFSET = {LOG_OFFSET:#x};
+inline constexpr double LOG_TABLE[{2 << LOG_TABLE_BITS}] = {{
+    {format_table(log_table).replace(chr(10) + '        ', chr(10) + '    ')}
+}};
+inline constexpr int LOG1P_DEGREE = 7;
+inline constexpr double LOG1P[LOG1P_DEGREE + 1] = {{
+    1.0, -1.0 / 2, 1.0 / 3, -1.0 / 4, 1.0 / 5, -1.0 / 6, 1.0 / 7, -1.0 / 8
+}};
+
+QUANT_CONSTEXPR uint64_t bits_of(double x) {{
+#if defined(QUANT_ENABLE_CONSTEXPR)
+    return __builtin_bit_cast(uint64_t, x);
+#else
+    uint64_t bits = 0;
+    memcpy(&bits, &x, sizeof bits);
+    return bits;
+#endif
+}}
+
+QUANT_CONSTEXPR double from_bits(uint64_t bits) {{
+#if defined(QUANT_ENABLE_CONSTEXPR)
+    return __builtin_bit_cast(double, bits);
+#else
+    double x = 0.0;
+    memcpy(&x, &bits, sizeof x);
+    return x;
+#endif
+}}
+
+// 2^k for -1022 <= k <= 1023
+QUANT_CONSTEXPR double pow2(int k) {{
+    return from_bits(uint64_t(k + 1023) << 52);
+}}
+
+// The compare-and-negate folds at compile time; at run time fabs is a
+// single mask, where the compare costs the central path ~10%
+QUANT_CONSTEXPR double abs(double x) {{
+#if defined(QUANT_ENABLE_CONSTEXPR)
+    if (__builtin_is_constant_evaluated()) return x < 0.0 ? -x : x;
+#endif
+    return std::fabs(x);
+}}
+
+// a * b + c, fused when the target has FMA. GCC folds __builtin_fma exactly
+// in constant expressions, so both forms agree between compile and run time.
+QUANT_CONSTEXPR double fmadd(double a, double b, double c) {{
+#if defined(__FMA__) && defined(__GNUC__) && !defined(__clang__)
+    return __builtin_fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}}
+
+// c[0] + x (c[1] + x (c[2] + ...)), n coefficients
+QUANT_CONSTEXPR double horner(const double* c, int n, double x) {{
+    double p = c[n - 1];
+    for (int i = n - 2; i >= 0; --i) {{
+        p = fmadd(p, x, c[i]);
+    }}
+    return p;
+}}
+
+// Correctly rounded square root of a positive normal x: the 53-bit root of
+// the mantissa scaled to 104-106 bits, digit by digit, rounded to nearest
+QUANT_CONSTEXPR double sqrt_exact(double x) {{
+    const uint64_t bits = bits_of(x);
+    const int q = int(bits >> 52) - 1075;
+    const uint64_t M = (bits & ((uint64_t(1) << 52) - 1)) | (uint64_t(1) << 52);
+    const int s = ((q - 52) & 1) ? 53 : 52;
+
+    uint64_t root = 0, rem = 0;
+    for (int pair = 52; pair >= 0; --pair) {{
+        const int lo = 2 * pair - s;
+        uint64_t next = 0;
+        if (lo + 1 >= 0 && lo + 1 < 53) next |= ((M >> (lo + 1)) & 1) << 1;
+        if (lo >= 0 && lo < 53) next |= (M >> lo) & 1;
+        rem = (rem << 2) | next;
+        const uint64_t trial = (root << 2) | 1;
+        if (rem >= trial) {{
+            rem -= trial;
+            root = (root << 1) | 1;
+        }} else {{
+            root <<= 1;
+        }}
+    }}
+    if (rem > root) ++root;
+
+    return double(root) * pow2((q - s) / 2);
+}}
+
+// Hardware at run time, sqrt_exact() in constant expressions: both are
+// correctly rounded, so they agree
+QUANT_CONSTEXPR double sqrt_portable(double x) {{
+#if defined(QUANT_ENABLE_CONSTEXPR)
+    if (!__builtin_is_constant_evaluated()) return std::sqrt(x);
+#else
+    return std::sqrt(x);
+#endif
+    if (x != x || x < 0.0) return numeric_limits<double>::quiet_NaN();
+    if (x == 0.0 || x == numeric_limits<double>::infinity()) return x;
+    if (x < numeric_limits<double>::min()) return sqrt_exact(x * 0x1p54) * 0x1p-27;
+    return sqrt_exact(x);
+}}
+
+// y * 2^k for y in [0.5, 2] and the k range reached by exp()
+QUANT_CONSTEXPR double scale(double y, int k) {{
+    if (k > 1023) return y * pow2(1023) * pow2(k - 1023);
+    if (k < -1021) return y * pow2(k + 54) * 0x1p-54;
+    return y * pow2(k);
+}}
+
+// 2^(j/128) exp(r) for x + x_lo reduced at n = 128 k + j
+QUANT_CONSTEXPR double exp_reduced(double x, double x_lo, int n) {{
+    const double r = (x - double(n) * EXP_STEP_HI) - double(n) * EXP_STEP_LO + x_lo;
+    const double P = horner(EXP_TAYLOR, EXP_DEGREE, r);
+    const double t = EXP_TABLE[n & (EXP_TABLE_SIZE - 1)];
+    return fmadd(t, r * P, t);
+}}
+
+// exp(x + x_lo) for an argument carried in two parts: x + x_lo =
+// (128 k + j) ln2 / 128 + r with |r| <= ln2 / 256, and exp = 2^k 2^(j/128) exp(r)
+// with 2^(j/128) tabulated and a degree-5 Taylor polynomial for exp(r) - 1
+QUANT_CONSTEXPR double exp_split(double x, double x_lo) {{
+    const double sum = x + x_lo;
+    if (sum != sum) return sum;
+    if (sum > EXP_OVERFLOW) return numeric_limits<double>::infinity();
+    if (sum < EXP_UNDERFLOW) return 0.0;
+
+    const int n = int(sum * EXP_INV_STEP + (sum < 0.0 ? -0.5 : 0.5));
+    return scale(exp_reduced(x, x_lo, n), n >> EXP_TABLE_BITS);
+}}
+
+// exp_split() for EXP_NORMAL_MIN <= x + x_lo <= 0, where the result is a
+// normal double: no range checks, so loops over it vectorize, and the same
+// operations as exp_split(), so the result is bit-identical
+QUANT_CONSTEXPR double exp_split_normal(double x, double x_lo) {{
+    const int n = int((x + x_lo) * EXP_INV_STEP - 0.5);
+    return exp_reduced(x, x_lo, n) * pow2(n >> EXP_TABLE_BITS);
+}}
+
+QUANT_CONSTEXPR double exp_portable(double x) {{
+    return exp_split(x, 0.0);
+}}
+
+// exp(x) - 1: Taylor series for |x| < ln2 / 2, exp(x) - 1 beyond
+QUANT_CONSTEXPR double expm1_portable(double x) {{
+    constexpr int DEGREE = 14;
+    constexpr double TAYLOR[DEGREE] = {{
+        1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720, 1.0 / 5040,
+        1.0 / 40320, 1.0 / 362880, 1.0 / 3628800, 1.0 / 39916800,
+        1.0 / 479001600, 1.0 / 6227020800, 1.0 / 87178291200
+    }};
+
+    if (abs(x) < 0.5 * LN2) {{
+        double P = TAYLOR[DEGREE - 1];
+        for (int i = DEGREE - 2; i >= 0; --i) {{
+            P = fmadd(P, x, TAYLOR[i]);
+        }}
+        return x * P;
+    }}
+    return exp_portable(x) - 1.0;
+}}
+
+// log y for positive normal finite y: y = 2^e f with f in [0.6875, 1.375)
+// from the IEEE fields; LOG_TABLE_BITS bits past LOG_OFFSET pick a cell with
+// tabulated 1/c and log c, and log f = log c + log1p(f / c - 1) with
+// |f / c - 1| <= 2^-7. The two cells next to 1 use c = 1, so log y keeps its
+// relative precision as y -> 1. Table lookup and multiply-adds only.
+// e ln 2 is split so that e LN2_HI + log c carries the only large rounding;
+// e_bias is added to the exponent (log of a prescaled subnormal).
+QUANT_CONSTEXPR double log_core(double y, int e_bias = 0) {{
+    const uint64_t bits = bits_of(y);
+    const uint64_t shifted = bits - LOG_OFFSET;
+    const int e = int(int64_t(shifted) >> 52) + e_bias;
+    const size_t i = size_t(shifted >> (52 - LOG_TABLE_BITS)) & ((size_t(1) << LOG_TABLE_BITS) - 1);
+    const double f = from_bits(bits - (shifted & (uint64_t(0xFFF) << 52)));
+
+    // 1/c has 32 significant bits, so with f split at 21 bits the first
+    // product is exact and r carries a single rounding
+    const double f_hi = from_bits(bits_of(f) & 0xFFFFFFFF00000000ull);
+    const double r = (f_hi * LOG_TABLE[2 * i] - 1.0) + (f - f_hi) * LOG_TABLE[2 * i];
+    const double P = horner(LOG1P, LOG1P_DEGREE + 1, r);
+
+    const double hi = fmadd(double(e), LN2_HI, LOG_TABLE[2 * i + 1]);
+    return hi + fmadd(r, P, double(e) * LN2_LO);
+}}
+
+QUANT_CONSTEXPR double log_portable(double x) {{
+    if (x != x || x < 0.0) return numeric_limits<double>::quiet_NaN();
+    if (x == 0.0) return -numeric_limits<double>::infinity();
+    if (x == numeric_limits<double>::infinity()) return x;
+    if (x < numeric_limits<double>::min()) return log_core(x * 0x1p54, -54);
+    return log_core(x);
+}}
+
+// fdlibm erfc coefficients and region bounds in |x|
+inline constexpr double ERFC_ERX = 8.45062911510467529297e-01;
+inline constexpr double ERFC_PP[5] = {{
+    1.28379167095512558561e-01, -3.25042107247001499370e-01, -2.84817495755985104766e-02,
+    -5.77027029648944159157e-03, -2.37630166566501626084e-05
+}};
+inline constexpr double ERFC_QQ[6] = {{
+    1.0, 3.97917223959155352819e-01, 6.50222499887672944485e-02,
+    5.08130628187576562776e-03, 1.32494738004321644526e-04, -3.96022827877536812320e-06
+}};
+inline constexpr double ERFC_PA[7] = {{
+    -2.36211856075265944077e-03, 4.14856118683748331666e-01, -3.72207876035701323847e-01,
+    3.18346619901161753674e-01, -1.10894694282396677476e-01, 3.54783043256182359371e-02,
+    -2.16637559486879084300e-03
+}};
+inline constexpr double ERFC_QA[7] = {{
+    1.0, 1.06420880400844228286e-01, 5.40397917702171048937e-01, 7.18286544141962662868e-02,
+    1.26171219808761642112e-01, 1.36370839120290507362e-02, 1.19844998467991074170e-02
+}};
+inline constexpr double ERFC_RA[8] = {{
+    -9.86494403484714822705e-03, -6.93858572707181764372e-01, -1.05586262253232909814e+01,
+    -6.23753324503260060396e+01, -1.62396669462573470355e+02, -1.84605092906711035994e+02,
+    -8.12874355063065934246e+01, -9.81432934416914548592e+00
+}};
+inline constexpr double ERFC_SA[9] = {{
+    1.0, 1.96512716674392571292e+01, 1.37657754143519042600e+02, 4.34565877475229228821e+02,
+    6.45387271733267880336e+02, 4.29008140027567833386e+02, 1.08635005541779435134e+02,
+    6.57024977031928170135e+00, -6.04244152148580987438e-02
+}};
+inline constexpr double ERFC_RB[7] = {{
+    -9.86494292470009928597e-03, -7.99283237680523006574e-01, -1.77579549177547519889e+01,
+    -1.60636384855821916062e+02, -6.37566443368389627722e+02, -1.02509513161107724954e+03,
+    -4.83519191608651397019e+02
+}};
+inline constexpr double ERFC_SB[8] = {{
+    1.0, 3.03380607434824582924e+01, 3.25792512996573918826e+02, 1.53672958608443695994e+03,
+    3.19985821950859553908e+03, 2.55305040643316442583e+03, 4.74528541206955367215e+02,
+    -2.24409524465858183362e+01
+}};
+inline constexpr double ERFC_SMALL_MAX = 0.84375;
+inline constexpr double ERFC_NEAR_MAX = 1.25;
+inline constexpr double ERFC_MID_MAX = 1.0 / 0.35;
+inline constexpr double ERFC_NORMAL_MAX = 26.0;    // exp(-a^2) still normal
+inline constexpr double ERFC_ZERO = 28.0;          // erfc(a) underflows
+inline constexpr double ERFC_TWO = 6.0;            // erfc(-a) rounds to 2
+
+// Complementary error function after fdlibm s_erf.c (< 1 ulp). Each region
+// is its own branch-free function of a = |x|, so batch code can sort inputs
+// by region and run each as a vectorizable loop with bit-identical results.
+QUANT_CONSTEXPR double erfc_small(double a, bool negative) {{
+    const double z = a * a;
+    const double y = horner(ERFC_PP, 5, z) / horner(ERFC_QQ, 6, z);
+    double t = a < 0.25 ? fmadd(a, y, a) : 0.5 + fmadd(a, y, a - 0.5);
+    if (a < 0x1p-56) t = a;
+    return negative ? 1.0 + t : 1.0 - t;
+}}
+
+QUANT_CONSTEXPR double erfc_near(double a, bool negative) {{
+    const double s = a - 1.0;
+    const double P = horner(ERFC_PA, 7, s);
+    const double Q = horner(ERFC_QA, 7, s);
+    return negative ? 1.0 + ERFC_ERX + P / Q : 1.0 - ERFC_ERX - P / Q;
+}}
+
+// R/S of the two tail regions, in s = 1 / a^2
+QUANT_CONSTEXPR double erfc_mid_ratio(double a) {{
+    const double s = 1.0 / (a * a);
+    return horner(ERFC_RA, 8, s) / horner(ERFC_SA, 9, s);
+}}
+
+QUANT_CONSTEXPR double erfc_far_ratio(double a) {{
+    const double s = 1.0 / (a * a);
+    return horner(ERFC_RB, 7, s) / horner(ERFC_SB, 8, s);
+}}
+
+// Tail from the ratio: exp(-a^2) as exp(-z^2) exp((z - a)(z + a)) with
+// z = a cut to 20 bits
+QUANT_CONSTEXPR double erfc_tail(double a, bool negative, double ratio) {{
+    const double z = from_bits(bits_of(a) & 0xFFFFFFFF00000000ull);
+    const double r = exp_split(-z * z - 0.5625, (z - a) * (z + a) + ratio);
+    return negative ? 2.0 - r / a : r / a;
+}}
+
+// The same for a < ERFC_NORMAL_MAX, where exp(-a^2) stays a normal double
+QUANT_CONSTEXPR double erfc_tail_normal(double a, bool negative, double ratio) {{
+    const double z = from_bits(bits_of(a) & 0xFFFFFFFF00000000ull);
+    const double r = exp_split_normal(-z * z - 0.5625, (z - a) * (z + a) + ratio);
+    return negative ? 2.0 - r / a : r / a;
+}}
+
+QUANT_CONSTEXPR double erfc_portable(double x) {{
+    if (x != x) return x;
+    const bool negative = x < 0.0;
+    const double a = abs(x);
+
+    if (a < ERFC_SMALL_MAX) return erfc_small(a, negative);
+    if (a < ERFC_NEAR_MAX) return erfc_near(a, negative);
+    if (a < ERFC_ZERO) {{
+        if (negative && a > ERFC_TWO) return 2.0;
+        return erfc_tail(a, negative, a < ERFC_MID_MAX ? erfc_mid_ratio(a) : erfc_far_ratio(a));
+    }}
+    return negative ? 2.0 : 0.0;
+}}
+
+#if defined(QUANT_ENABLE_CONSTEXPR)
+QUANT_CONSTEXPR double exp(double x) {{ return exp_portable(x); }}
+QUANT_CONSTEXPR double expm1(double x) {{ return expm1_portable(x); }}
+QUANT_CONSTEXPR double log(double x) {{ return log_portable(x); }}
+QUANT_CONSTEXPR double erfc(double x) {{ return erfc_portable(x); }}
+QUANT_CONSTEXPR double sqrt(double x) {{ return sqrt_portable(x); }}
+#else
+inline double exp(double x) {{ return std::exp(x); }}
+inline double expm1(double x) {{ return std::expm1(x); }}
+inline double log(double x) {{ return std::log(x); }}
+inline double erfc(double x) {{ return std::erfc(x); }}
+inline double sqrt(double x) {{ return std::sqrt(x); }}
+#endif
+
+}} // namespace detail
+
 class InverseCumulativeNormal {{
   public:
-    explicit InverseCumulativeNormal(double average = 0.0, double sigma = 1.0)
+    explicit constexpr InverseCumulativeNormal(double average = 0.0, double sigma = 1.0)
     : average_(average), sigma_(sigma) {{}}
 
-    inline double operator()(double x) const {{
+    QUANT_CONSTEXPR double operator()(double x) const {{
         return average_ + sigma_ * standard_value(x);
     }}
 
@@ -65,11 +474,128 @@ class InverseCumulativeNormal {{
         }}
     }}
 
-    static inline double standard_value(double x) {{
+    // Per-element parameters: out[i] = mu[i] + sigma[i] * Phi^{{-1}}(x[i]).
+    // The object's own average and sigma are not used. Works in blocks of
+    // TRANSFORM_BLOCK: standard quantiles go to out, then a separate sweep
+    // applies the affine step as one FMA per element while the block is
+    // still in L1, so that loop vectorizes.
+    inline void transform(const double* x, const double* mu, const double* sigma,
+                          double* out, size_t n) const {{
+        for (size_t b = 0; b < n; b += TRANSFORM_BLOCK) {{
+            const size_t end = min(n, b + TRANSFORM_BLOCK);
+            for (size_t i = b; i < end; ++i) {{
+                out[i] = standard_value(x[i]);
+            }}
+            for (size_t i = b; i < end; ++i) {{
+                out[i] = detail::fmadd(sigma[i], out[i], mu[i]);
+            }}
+        }}
+    }}
+
+    // Streams n quantiles through a tile buffer on the stack, for consumers
+    // that read each value once. The tile count m is fixed here, never more
+    // than the capacity, before source(tile, m) writes exactly m
+    // probabilities; the tile is transformed in place and handed to
+    // consumer(tile, m) before the next fill. tile_size is capped at
+    // MAX_TILE (16 KB of doubles, within L1).
+    template <class Source, class Consumer>
+    inline void generate_tiles(size_t n, Source source, size_t tile_size, Consumer consumer) const {{
+        double tile[MAX_TILE];
+        const size_t capacity = min(max<size_t>(tile_size, 1), MAX_TILE);
+        for (size_t b = 0; b < n; b += capacity) {{
+            const size_t m = min(n - b, capacity);
+            source(tile, m);
+            (*this)(tile, tile, m);
+            consumer(static_cast<const double*>(tile), m);
+        }}
+    }}
+
+    // One probability, many (mu, sigma): Phi^{{-1}}(x) is evaluated once
+    inline void transform(double x, const double* mu, const double* sigma,
+                          double* out, size_t n) const {{
+        const double z = standard_value(x);
+        for (size_t i = 0; i < n; ++i) {{
+            out[i] = detail::fmadd(sigma[i], z, mu[i]);
+        }}
+    }}
+
+    // Strided batch, strides in elements: out[i * out_stride] =
+    // quantile(in[i * in_stride]), e.g. one field of an array of structs.
+    // Inputs are packed a block at a time into a stack buffer, run through
+    // the contiguous batch and scattered back, so no full-size copy is made.
+    inline void operator()(const double* in, size_t in_stride,
+                           double* out, size_t out_stride, size_t n) const {{
+        double block[TRANSFORM_BLOCK];
+        for (size_t b = 0; b < n; b += TRANSFORM_BLOCK) {{
+            const size_t m = min(n - b, TRANSFORM_BLOCK);
+            for (size_t i = 0; i < m; ++i) {{
+                block[i] = in[(b + i) * in_stride];
+            }}
+            (*this)(block, block, m);
+            for (size_t i = 0; i < m; ++i) {{
+                out[(b + i) * out_stride] = block[i];
+            }}
+        }}
+    }}
+
+    // Indexed batch over a subset of rows: out[index[i]] = quantile(in[index[i]])
+    // for i < n; entries of out not named by index are left untouched
+    inline void operator()(const double* in, const size_t* index, double* out, size_t n) const {{
+        double block[TRANSFORM_BLOCK];
+        for (size_t b = 0; b < n; b += TRANSFORM_BLOCK) {{
+            const size_t m = min(n - b, TRANSFORM_BLOCK);
+            for (size_t i = 0; i < m; ++i) {{
+                block[i] = in[index[b + i]];
+            }}
+            (*this)(block, block, m);
+            for (size_t i = 0; i < m; ++i) {{
+                out[index[b + i]] = block[i];
+            }}
+        }}
+    }}
+
+    // Row-major n_levels x n matrix out[k * n + i] = mu[i] + sigma[i] *
+    // Phi^{{-1}}(levels[k]): n_levels quantile evaluations, then an FMA sweep.
+    // Columns go in blocks of MATRIX_BLOCK so the mu and sigma slices stay in
+    // L1 across all levels while every row is written contiguously. Outputs of
+    // STREAM_MIN doubles or more are written with non-temporal stores on AVX
+    // targets: the matrix is not read back here, so it bypasses the caches
+    // instead of evicting mu and sigma.
+    inline void quantile_matrix(const double* levels, size_t n_levels,
+                                const double* mu, const double* sigma, size_t n,
+                                double* out) const {{
+        if (n == 0) return;
+        // Park each standard quantile in the last column of its row; that
+        // entry is read before its row is swept and written by the last block
+        for (size_t k = 0; k < n_levels; ++k) {{
+            out[k * n + n - 1] = standard_value(levels[k]);
+        }}
+        const bool stream = n_levels * n >= STREAM_MIN;
+        for (size_t b = 0; b < n; b += MATRIX_BLOCK) {{
+            const size_t end = min(n, b + MATRIX_BLOCK);
+            for (size_t k = 0; k < n_levels; ++k) {{
+                double* row = out + k * n;
+                const double z = row[n - 1];
+                if (stream) {{
+                    stream_fmadd(sigma, z, mu, row, b, end);
+                    continue;
+                }}
+                for (size_t i = b; i < end; ++i) {{
+                    row[i] = detail::fmadd(sigma[i], z, mu[i]);
+                }}
+            }}
+        }}
+#if defined(__AVX__)
+        if (stream) _mm_sfence();
+#endif
+    }}
+
+    static QUANT_CONSTEXPR double standard_value(double x) {{
         if (x <= 0.0) return -numeric_limits<double>::infinity();
         if (x >= 1.0) return  numeric_limits<double>::infinity();
+        if (x < numeric_limits<double>::min()) return lower_from_log(detail::log(x));
 
-        double z;
+        double z = 0.0;
         if (x < x_low_ || x > x_high_) {{
             z = tail_value(x);
         }} else {{
@@ -82,8 +608,298 @@ class InverseCumulativeNormal {{
         return z;
     }}
 
+    // Quantile with the density of N(average, sigma^2) at it, pdf =
+    // phi(z_std) / sigma. z matches operator() bit for bit; pdf comes from
+    // the density the last Halley step already evaluated, carried across
+    // that step, so no further exp is taken. dz/dx = 1 / pdf.
+    QUANT_CONSTEXPR void quantile_and_density(double x, double* z, double* pdf) const {{
+        double p = 0.0;
+        const double s = standard_value_and_density(x, p);
+        *z = average_ + sigma_ * s;
+        *pdf = p / sigma_;
+    }}
+
+    inline void quantile_and_density(const double* in, double* z, double* pdf, size_t n) const {{
+        for (size_t i = 0; i < n; ++i) {{
+            quantile_and_density(in[i], z + i, pdf + i);
+        }}
+    }}
+
+    // z = Phi^{{-1}}(x) scaled, dz/dx = sigma / phi and, when d2z_dx2 is not
+    // null, d2z/dx2 = sigma z_std / phi^2 for Hessian-based optimizers
+    QUANT_CONSTEXPR void quantile_derivatives(double x, double* z, double* dz_dx, double* d2z_dx2 = nullptr) const {{
+        double p = 0.0;
+        const double s = standard_value_and_density(x, p);
+        *z = average_ + sigma_ * s;
+        *dz_dx = sigma_ / p;
+        if (d2z_dx2) *d2z_dx2 = sigma_ * s / (p * p);
+    }}
+
+    inline void quantile_derivatives(const double* in, double* z, double* dz_dx, double* d2z_dx2,
+                                     size_t n) const {{
+        for (size_t i = 0; i < n; ++i) {{
+            quantile_derivatives(in[i], z + i, dz_dx + i, d2z_dx2 ? d2z_dx2 + i : nullptr);
+        }}
+    }}
+
+    // standard_value(x), also setting p = phi(z). The second Halley step
+    // moves z only slightly (|t| < 2e-6 below), so phi(z1) = phi(z0) exp(t)
+    // with t = -(z1 - z0)(z1 + z0)/2 is phi(z0)(1 + t + t^2/2) to rounding.
+    static QUANT_CONSTEXPR double standard_value_and_density(double x, double& p) {{
+        if (x <= 0.0 || x >= 1.0 || x < numeric_limits<double>::min()) {{
+            const double z = standard_value(x);
+            p = phi(z);
+            return z;
+        }}
+
+        double z = 0.0;
+        if (x < x_low_ || x > x_high_) {{
+            z = tail_value(x);
+        }} else {{
+            z = central_value(x);
+        }}
+
+        z = halley_refine(z, x);
+        const double p0 = phi(z);
+        const double z1 = halley_step(z, x, p0);
+        const double t = -0.5 * (z1 - z) * (z1 + z);
+        p = detail::fmadd(p0, t * detail::fmadd(0.5, t, 1.0), p0);
+
+        return z1;
+    }}
+
+    // Quantile from a survival probability: Phi^{{-1}}(1 - q) = -Phi^{{-1}}(q).
+    // 1 - q is never formed, so q far below 1e-16 keeps full precision.
+    QUANT_CONSTEXPR double from_q(double q) const {{
+        return average_ - sigma_ * standard_value(q);
+    }}
+
+    inline void from_q(const double* in, double* out, size_t n) const {{
+        for (size_t i = 0; i < n; ++i) {{
+            out[i] = average_ - sigma_ * standard_value(in[i]);
+        }}
+    }}
+
+    // Quantile of the uniform u = (bits + 1/2) / 2^64 taken straight from a
+    // raw 64-bit random word. The top bit selects the half and the other 63
+    // bits count from the nearer end of (0, 1), so m = min(u, 1 - u) is formed
+    // exactly down to 2^-65: the result is always finite and reaches |z| ~ 9,
+    // beyond the 2^-53 floor of a double uniform.
+    QUANT_CONSTEXPR double from_bits(uint64_t bits) const {{
+        return average_ + sigma_ * standard_from_bits(bits);
+    }}
+
+    inline void from_bits(const uint64_t* in, double* out, size_t n) const {{
+        for (size_t i = 0; i < n; ++i) {{
+            out[i] = average_ + sigma_ * standard_from_bits(in[i]);
+        }}
+    }}
+
+    static QUANT_CONSTEXPR double standard_from_bits(uint64_t bits) {{
+        const bool upper = (bits >> 63) != 0;
+        const uint64_t k = upper ? ~bits : bits;
+        const double m = (double(k) + 0.5) * 0x1p-64;
+        
+        // m < 2^-lz: six or more leading zeros is always tail, four or fewer
+        // always central; only lz == 5 straddles x_low_
+        const int lz = leading_zeros(k);
+        const bool tail = lz > 5 || (lz == 5 && m < x_low_);
+        
+        double z = tail ? lower_tail_seed(detail::log_core(m)) : central_value(m);
+        z = halley_refine(z, m);
+        z = halley_refine(z, m);
+        
+        return upper ? -z : z;
+    }}
+
+    // Quantile from a log-probability: Phi^{{-1}}(exp(log_p)). Reaches tail
+    // probabilities far below DBL_MIN and never forms p itself.
+    QUANT_CONSTEXPR double from_log_p(double log_p) const {{
+        return average_ + sigma_ * standard_from_log_p(log_p);
+    }}
+
+    // Quantile from a log survival probability: Phi^{{-1}}(1 - exp(log_q))
+    QUANT_CONSTEXPR double from_log_q(double log_q) const {{
+        return average_ - sigma_ * standard_from_log_p(log_q);
+    }}
+
+    inline void from_log_p(const double* in, double* out, size_t n) const {{
+        for (size_t i = 0; i < n; ++i) {{
+            out[i] = average_ + sigma_ * standard_from_log_p(in[i]);
+        }}
+    }}
+
+    inline void from_log_q(const double* in, double* out, size_t n) const {{
+        for (size_t i = 0; i < n; ++i) {{
+            out[i] = average_ - sigma_ * standard_from_log_p(in[i]);
+        }}
+    }}
+
+    static QUANT_CONSTEXPR double standard_from_log_p(double log_p) {{
+        if (log_p >= 0.0) return numeric_limits<double>::infinity();
+        if (log_p > -detail::LN2) {{
+            return -lower_from_log(detail::log(-detail::expm1(log_p)));
+        }}
+        return lower_from_log(log_p);
+    }}
+
+    // Quantiles of the regular grid x_i = (i + offset) / n, i = 0..n-1
+    // (offset 0.5 gives midpoints). Each point is seeded from its neighbour
+    // by a Taylor step and finished with a single Halley correction.
+    // Points above 0.5 are computed as -Phi^{{-1}}(1 - x_i), which is itself a
+    // grid with offset 1 - offset, so no walk ever works near x = 1.
+    inline void quantile_grid(size_t n, double offset, double* out) const {{
+        if (n == 0) return;
+        const double h = 1.0 / double(n);
+        const double last_low = floor(0.5 * double(n) - offset);
+        const size_t n_low = last_low < 0.0 ? 0 : min(n, size_t(last_low) + 1);
+        
+        walk_grid(n_low, offset, h, 1.0, out, 1);
+        walk_grid(n - n_low, 1.0 - offset, h, -1.0, out + (n - 1), -1);
+    }}
+
+    // Batch for sorted or nearly sorted input. Each element is seeded from
+    // the previous output with continue_from() instead of the rational
+    // approximation, falling back to standard_value() across large gaps.
+    // Chains run on m = min(x, 1 - x) and restart when x crosses 0.5, so the
+    // upper half is as accurate as the lower one. Any order gives correct
+    // results; the speedup comes from small gaps.
+    inline void warm_start(const double* in, double* out, size_t n) const {{
+        const size_t len = (n + GRID_CHAINS - 1) / GRID_CHAINS;
+        double m[GRID_CHAINS] = {{}};
+        double z[GRID_CHAINS] = {{}};
+        double p[GRID_CHAINS] = {{}};
+        bool upper[GRID_CHAINS] = {{}};
+        
+        for (size_t t = 0; t < len; ++t) {{
+            for (size_t c = 0; c < GRID_CHAINS; ++c) {{
+                const size_t i = c * len + t;
+                if (i >= n) break;
+                const double xi = in[i];
+                const bool up = xi > 0.5;
+                const double mi = up ? 1.0 - xi : xi;
+                if (t > 0 && p[c] > 0.0 && up == upper[c]) {{
+                    z[c] = continue_from(z[c], p[c], mi - m[c], mi);
+                }} else {{
+                    z[c] = standard_value(mi);
+                    p[c] = isfinite(z[c]) ? phi(z[c]) : 0.0;
+                }}
+                m[c] = mi;
+                upper[c] = up;
+                out[i] = average_ + sigma_ * (up ? -z[c] : z[c]);
+            }}
+        }}
+    }}
+
+    // Piecewise-polynomial engine for bulk batches: no transcendental calls
+    // and no refinement. m = min(x, 1 - x) is located by its IEEE exponent
+    // (octave) and leading SEGMENT_BITS mantissa bits (cell); the remaining
+    // mantissa bits give s in [-1, 1), and the cell's polynomial in s is the
+    // quantile. m below SEGMENT_M_MIN falls back to standard_value().
+    QUANT_CONSTEXPR double segmented(double x) const {{
+        return average_ + sigma_ * segmented_value(x);
+    }}
+
+    inline void segmented(const double* in, double* out, size_t n) const {{
+        for (size_t i = 0; i < n; ++i) {{
+            out[i] = average_ + sigma_ * segmented_value(in[i]);
+        }}
+    }}
+
+    static QUANT_CONSTEXPR double segmented_value(double x) {{
+        if (x <= 0.0) return -numeric_limits<double>::infinity();
+        if (x >= 1.0) return  numeric_limits<double>::infinity();
+        
+        const bool upper = x > 0.5;
+        const double m = upper ? 1.0 - x : x;
+        if (!(m >= SEGMENT_M_MIN)) return standard_value(x);
+        if (m == 0.5) return 0.0;
+        
+        // m in [2^-(octave + 2), 2^-(octave + 1))
+        const uint64_t bits = detail::bits_of(m);
+        const size_t octave = size_t(1021 - int(bits >> 52));
+        const size_t cell = (octave << SEGMENT_BITS) | size_t((bits >> SEGMENT_SHIFT) & SEGMENT_CELL_MASK);
+        const double s = double(bits & SEGMENT_FRACTION_MASK) * SEGMENT_SCALE - 1.0;
+        const double* c = &SEGMENT_COEFFS[cell * (SEGMENT_DEGREE + 1)];
+        
+        double z = c[SEGMENT_DEGREE];
+        for (int i = SEGMENT_DEGREE - 1; i >= 0; --i) {{
+            z = detail::fmadd(z, s, c[i]);
+        }}
+        
+        return upper ? -z : z;
+    }}
+
   private:
-    static inline double central_value(double x) {{
+    // row[i] = sigma[i] * z + mu[i] for i in [b, end), bit-identical to the
+    // fmadd sweep, with 32-byte aligned non-temporal stores on AVX targets
+    static inline void stream_fmadd(const double* sigma, double z, const double* mu,
+                                    double* row, size_t b, size_t end) {{
+        size_t i = b;
+#if defined(__AVX__)
+        for (; i < end && (reinterpret_cast<uintptr_t>(row + i) & 31) != 0; ++i) {{
+            row[i] = detail::fmadd(sigma[i], z, mu[i]);
+        }}
+        const __m256d zv = _mm256_set1_pd(z);
+        for (; i + 4 <= end; i += 4) {{
+#if defined(__FMA__)
+            const __m256d y = _mm256_fmadd_pd(_mm256_loadu_pd(sigma + i), zv, _mm256_loadu_pd(mu + i));
+#else
+            const __m256d y = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(sigma + i), zv), _mm256_loadu_pd(mu + i));
+#endif
+            _mm256_stream_pd(row + i, y);
+        }}
+#endif
+        for (; i < end; ++i) {{
+            row[i] = detail::fmadd(sigma[i], z, mu[i]);
+        }}
+    }}
+
+    // Walk x_j = (j + offset) * h for j < count, writing sign * Phi^{{-1}}(x_j)
+    // to out[j * stride]. The range is split into GRID_CHAINS contiguous
+    // segments walked in lockstep so their dependency chains overlap.
+    inline void walk_grid(size_t count, double offset, double h, double sign,
+                          double* out, ptrdiff_t stride) const {{
+        const size_t len = (count + GRID_CHAINS - 1) / GRID_CHAINS;
+        double z[GRID_CHAINS] = {{}};
+        double p[GRID_CHAINS] = {{}};
+        
+        for (size_t t = 0; t < len; ++t) {{
+            for (size_t c = 0; c < GRID_CHAINS; ++c) {{
+                const size_t j = c * len + t;
+                if (j >= count) break;
+                const double x = (double(j) + offset) * h;
+                if (t > 0 && p[c] > 0.0) {{
+                    z[c] = continue_from(z[c], p[c], h, x);
+                }} else {{
+                    z[c] = standard_value(x);
+                    p[c] = isfinite(z[c]) ? phi(z[c]) : 0.0;
+                }}
+                out[ptrdiff_t(j) * stride] = average_ + sigma_ * (sign * z[c]);
+            }}
+        }}
+    }}
+
+    // Step from a known quantile z = Phi^{{-1}}(x - dx) with density p = phi(z)
+    // to Phi^{{-1}}(x): second-order Taylor seed (dz/dx = 1/phi(z),
+    // d2z/dx2 = z/phi(z)^2) plus one Halley step; p is updated to the new
+    // density. Falls back to the full evaluation when the step is too long
+    // for one Halley step to converge.
+    static inline double continue_from(double z, double& p, double dx, double x) {{
+        const double dz = dx / p;
+        if (!(abs(dz) * (1.0 + abs(z)) < CONTINUATION_LIMIT) || x <= 0.0 || x >= 1.0) {{
+            const double z_full = standard_value(x);
+            p = isfinite(z_full) ? phi(z_full) : 0.0;
+            return z_full;
+        }}
+        const double seed = z + dz * (1.0 + 0.5 * z * dz);
+        const double p_seed = phi(seed);
+        const double z_new = halley_step(seed, x, p_seed);
+        p = p_seed * (1.0 - 0.5 * (z_new - seed) * (z_new + seed));
+        return z_new;
+    }}
+
+    static QUANT_CONSTEXPR double central_value(double x) {{
         const double u = x - 0.5;
         const double r = u * u;
         
@@ -100,70 +916,152 @@ class InverseCumulativeNormal {{
         return u * P / Q;
     }}
 
-    static inline double tail_value(double x) {{
+    static QUANT_CONSTEXPR double tail_value(double x) {{
         const double m = min(x, 1.0 - x);
-        const double t = sqrt(-2.0 * log(m));
         const double s = (x < 0.5) ? -1.0 : 1.0;
         
+        return -s * lower_tail_seed(detail::log_core(m));
+    }}
+
+
+    // Seed for Phi^{{-1}}(m), m < x_low_, from log m: the fitted rational in
+    // t = sqrt(-2 log m) within its range, and past it the asymptotic root
+    // of Phi(z) ~ phi(z) / |z|, z^2 ~ t^2 - log(2 pi t^2)
+    static QUANT_CONSTEXPR double lower_tail_seed(double log_m) {{
+        const double t = detail::sqrt(-2.0 * log_m);
+        if (t > TAIL_T_MAX) {{
+            return -detail::sqrt(t * t - detail::log_core(TWO_PI * t * t));
+        }}
+        
         double C = TAIL_C[TAIL_P];
         for (int i = TAIL_P - 1; i >= 0; --i) {{
-            C = C * t + TAIL_C[i];
+            C = detail::fmadd(C, t, TAIL_C[i]);
         }}
         
         double D = TAIL_D[TAIL_Q];
         for (int i = TAIL_Q - 1; i >= 0; --i) {{
-            D = D * t + TAIL_D[i];
+            D = detail::fmadd(D, t, TAIL_D[i]);
         }}
         
-        return s * C / D;
+        return -C / D;
+    }}
+
+    static QUANT_CONSTEXPR int leading_zeros(uint64_t k) {{
+#if defined(__GNUC__)
+        return k ? __builtin_clzll(k) : 64;
+#else
+        int n = 64;
+        while (k) {{
+            k >>= 1;
+            --n;
+        }}
+        return n;
+#endif
     }}
 
-    static inline double halley_refine(double z, double x) {{
-        const double r = compute_stable_residual(z, x);
-        const double denom = 1.0 - 0.5 * z * r;
+    // Phi^{{-1}}(exp(log_m)) for log_m <= -log 2, refined in log space
+    static QUANT_CONSTEXPR double lower_from_log(double log_m) {{
+        if (log_m == -numeric_limits<double>::infinity()) {{
+            return -numeric_limits<double>::infinity();
+        }}
         
-        if (abs(denom) < numeric_limits<double>::min()) {{
-            return z - copysign(numeric_limits<double>::infinity(), r);
+        double z = 0.0;
+        if (log_m >= LOG_X_LOW) {{
+            z = central_value(detail::exp(log_m));
+        }} else {{
+            z = lower_tail_seed(log_m);
+        }}
+        
+        z = log_halley_refine(z, log_m);
+        z = log_halley_refine(z, log_m);
+        
+        return z;
+    }}
+
+    // Halley step on f(z) = log Phi(z) - log_m, where f' = h = phi(z)/Phi(z)
+    // and f'' = -h (z + h). Like the expm1 tail residual, the mismatch is
+    // measured as a log ratio, so it never underflows.
+    static QUANT_CONSTEXPR double log_halley_refine(double z, double log_m) {{
+        const double log_cdf = log_Phi(z);
+        const double f = log_cdf - log_m;
+        const double h = detail::exp(-0.5 * z * z - LOG_SQRT_2PI - log_cdf);
+        
+        return z - (f / h) / (1.0 + 0.5 * f * (z + h) / h);
+    }}
+
+    // log Phi(z) for z <= 0. Below LOG_PHI_ASYMPTOTIC, where erfc underflows,
+    // uses Phi(z) = phi(z)/|z| * (1 - 1/z^2 + 3/z^4 - 15/z^6 + ...).
+    static QUANT_CONSTEXPR double log_Phi(double z) {{
+        if (z > LOG_PHI_ASYMPTOTIC) {{
+            return detail::log(Phi(z));
+        }}
+        
+        const double w = 1.0 / (z * z);
+        double S = 1.0;
+        for (int k = LOG_PHI_TERMS; k >= 1; --k) {{
+            S = 1.0 - (2 * k - 1) * w * S;
+        }}
+        
+        return -0.5 * z * z - detail::log(-z) - LOG_SQRT_2PI + detail::log(S);
+    }}
+
+    static QUANT_CONSTEXPR double halley_refine(double z, double x) {{
+        return halley_step(z, x, phi(z));
+    }}
+
+    // Halley step with the density p = phi(z) already known
+    static QUANT_CONSTEXPR double halley_step(double z, double x, double p) {{
+        const double r = compute_stable_residual(z, x, p);
+        const double denom = 1.0 + 0.5 * z * r;
+        
+        if (detail::abs(denom) < numeric_limits<double>::min()) {{
+            return r < 0.0 ? numeric_limits<double>::infinity() : -numeric_limits<double>::infinity();
         }}
         
         return z - r / denom;
     }}
 
-    static inline double compute_stable_residual(double z, double x) {{
+    static QUANT_CONSTEXPR double compute_stable_residual(double z, double x, double p) {{
         constexpr double TAIL_THRESHOLD = 1e-8;
-        const double p = phi(z);
         
-        if (x >= TAIL_THRESHOLD && x <= 1.0 - TAIL_THRESHOLD) {{
+        if (x >= TAIL_THRESHOLD && x <= 0.5) {{
             const double f = Phi(z);
             return (f - x) / max(p, numeric_limits<double>::min());
         }}
         
+        // Upper half: Phi(z) - x = (1 - x) - Q(z), where 1 - x is exact
+        // for x >= 0.5 and Q(z) keeps its relative precision
+        if (x > 0.5 && x <= 1.0 - TAIL_THRESHOLD) {{
+            const double y = 1.0 - x;
+            return (y - Q(z)) / max(p, numeric_limits<double>::min());
+        }}
+        
         if (x < 0.5) {{
             const double y = x;
-            const double log_q = log(Q(-z));
-            const double log_y = log(y);
-            return y * expm1(log_q - log_y) / max(p, numeric_limits<double>::min());
+            const double log_q = detail::log(Q(-z));
+            const double log_y = detail::log(y);
+            return y * detail::expm1(log_q - log_y) / max(p, numeric_limits<double>::min());
         }} else {{
             const double y = 1.0 - x;
-            const double log_q = log(Q(z));
-            const double log_y = log(y);
-            return -y * expm1(log_q - log_y) / max(p, numeric_limits<double>::min());
+            const double log_q = detail::log(Q(z));
+            const double log_y = detail::log(y);
+            return -y * detail::expm1(log_q - log_y) / max(p, numeric_limits<double>::min());
         }}
     }}
 
-    static inline double phi(double z) {{
+    static QUANT_CONSTEXPR double phi(double z) {{
         constexpr double INV_SQRT_2PI = 0.398942280401432677939946059934381868475858631164934657;
-        return INV_SQRT_2PI * exp(-0.5 * z * z);
+        return INV_SQRT_2PI * detail::exp(-0.5 * z * z);
     }}
 
-    static inline double Phi(double z) {{
+    static QUANT_CONSTEXPR double Phi(double z) {{
         constexpr double INV_SQRT_2 = 0.707106781186547524400844362104849039284835937688474036588;
-        return 0.5 * erfc(-z * INV_SQRT_2);
+        return 0.5 * detail::erfc(-z * INV_SQRT_2);
     }}
 
-    static inline double Q(double z) {{
+    static QUANT_CONSTEXPR double Q(double z) {{
         constexpr double INV_SQRT_2 = 0.707106781186547524400844362104849039284835937688474036588;
-        return 0.5 * erfc(z * INV_SQRT_2);
+        return 0.5 * detail::erfc(z * INV_SQRT_2);
     }}
 
     // ===== COEFFICIENTS FROM JSON =====
@@ -190,11 +1088,39 @@ class InverseCumulativeNormal {{
         {format_array(tail['coefficients_d'])}
     }};
 
+    // Segmented region: octave o covers m in [2^-(o+2), 2^-(o+1)), split into
+    // 2^SEGMENT_BITS cells; each cell stores SEGMENT_DEGREE + 1 monomial
+    // coefficients in s, lowest first, contiguously
+    static constexpr int SEGMENT_BITS = {segmented['segment_bits']};
+    static constexpr int SEGMENT_DEGREE = {segmented['degree']};
+    static constexpr int SEGMENT_OCTAVES = {segmented['octaves']};
+    static constexpr int SEGMENT_SHIFT = 52 - SEGMENT_BITS;
+    static constexpr uint64_t SEGMENT_CELL_MASK = (uint64_t(1) << SEGMENT_BITS) - 1;
+    static constexpr uint64_t SEGMENT_FRACTION_MASK = (uint64_t(1) << SEGMENT_SHIFT) - 1;
+    static constexpr double SEGMENT_SCALE = 0x1p-{51 - segmented['segment_bits']};
+    static constexpr double SEGMENT_M_MIN = 0x1p-{segmented['octaves'] + 1};
+    static constexpr double SEGMENT_COEFFS[{sum(len(r) for r in segmented['coefficients'])}] = {{
+        {format_table(segmented['coefficients'])}
+    }};
+
     // ===== END COEFFICIENTS =====
 
     double average_, sigma_;
+    static constexpr double CONTINUATION_LIMIT = 1e-2;
+    static constexpr size_t GRID_CHAINS = 4;
+    static constexpr size_t TRANSFORM_BLOCK = 256;
+    static constexpr size_t MATRIX_BLOCK = 512;
+    static constexpr size_t STREAM_MIN = size_t(1) << 20;  // 8 MB of output
+    static constexpr size_t MAX_TILE = 2048;
     static constexpr double x_low_  = {params['x_low']};
     static constexpr double x_high_ = {params['x_high']};
+    static constexpr double LOG_X_LOW = {math.log(params['x_low'])!r};
+    static constexpr double TAIL_T_MAX = 12.5;
+    static constexpr double LOG_PHI_ASYMPTOTIC = -37.0;
+    static constexpr int LOG_PHI_TERMS = 8;
+    static constexpr double TWO_PI = 6.283185307179586476925286766559005768;
+
+    static constexpr double LOG_SQRT_2PI = 0.918938533204672741780329736405617639;
 }};
 
 }} // namespace quant
@@ -1,4 +1,15 @@
 #include "InverseCumulativeNormal.h"
+#include "ParallelStreams.h"
+#include "LatinHypercube.h"
+#include "QuantizedInverseNormal.h"
+#include "QuantileCache.h"
+#include "CumulativeNormal.h"
+#include "ProbitAD.h"
+#include "InverseCumulativeStudentT.h"
+#include "InverseCumulativeGamma.h"
+#include "TruncatedNormal.h"
+#include "GaussianCopula.h"
+#include "VasicekLoss.h"
 #include <iostream>
 #include <iomanip>
 #include <vector>
@@ -6,6 +17,7 @@
 #include <chrono>
 #include <random>
 #include <algorithm>
+#include <cstring>
 
 using namespace std;
 using namespace quant;
@@ -29,6 +41,19 @@ double standard_normal_cdf(double z) {
     return 0.5 * erfc(-z * INV_SQRT_2);
 }
 
+// log Phi(z) for z <= 0, asymptotic series where erfc underflows
+double log_standard_normal_cdf(double z) {
+    if (z > -37.0) return log(standard_normal_cdf(z));
+    constexpr double LOG_SQRT_2PI = 0.918938533204672741780329736405617639;
+    const double w = 1.0 / (z * z);
+    double term = 1.0, series = 1.0;
+    for (int k = 1; k <= 12; ++k) {
+        term *= -(2 * k - 1) * w;
+        series += term;
+    }
+    return -0.5 * z * z - log(-z) - LOG_SQRT_2PI + log(series);
+}
+
 // Test symmetry: Φ^{-1}(1-x) = -Φ^{-1}(x)
 void test_symmetry() {
     cout << "\n=== Symmetry Test ===\n";
@@ -166,74 +191,1806 @@ void test_derivative() {
     cout << "Derivative test: " << (max_rel_error < 1e-4 ? "PASS" : "FAIL") << "\n";
 }
 
-// Benchmark scalar performance
-void benchmark_scalar() {
-    cout << "\n=== Scalar Performance Benchmark ===\n";
+// Test reproducibility: parallel normal streams are bit-identical for any thread count
+void test_parallel_streams() {
+    cout << "\n=== Parallel Stream Reproducibility Test ===\n";
     
-    const int n_calls = 10000000;
-    random_device rd;
-    mt19937 gen(42);
-    uniform_real_distribution<double> dist(1e-10, 1.0 - 1e-10);
+    const size_t n_paths = 5000;
+    const size_t dims = 16;
+    const size_t block_paths = 37;
+    const unsigned thread_counts[] = {1, 4, 64};
     
-    // Generate test data
-    vector<double> x_values(n_calls);
-    for (int i = 0; i < n_calls; ++i) {
-        x_values[i] = dist(gen);
+    auto identical_across_threads = [&](const auto& stream, const char* name) {
+        vector<double> reference(n_paths * dims);
+        generate_normals(stream, n_paths, reference.data(), 1, block_paths);
+        
+        bool identical = true;
+        for (unsigned n_threads : thread_counts) {
+            vector<double> out(n_paths * dims, 0.0);
+            generate_normals(stream, n_paths, out.data(), n_threads, block_paths);
+            if (memcmp(out.data(), reference.data(), out.size() * sizeof(double)) != 0) {
+                cout << name << ": output differs with " << n_threads << " threads\n";
+                identical = false;
+            }
+        }
+        return identical ? reference : vector<double>();
+    };
+    
+    bool pass = true;
+    
+    vector<double> block = identical_across_threads(
+        PseudoRandomNormals(42, dims, StreamLayout::block_split), "block_split");
+    vector<double> per_path = identical_across_threads(
+        PseudoRandomNormals(42, dims, StreamLayout::per_path), "per_path");
+    vector<double> sobol = identical_across_threads(SobolNormals(dims), "sobol");
+    pass = !block.empty() && !per_path.empty() && !sobol.empty();
+    
+    // Skip-ahead must agree with drawing the whole stream sequentially
+    if (pass) {
+        Philox4x32 rng(42);
+        InverseCumulativeNormal icn;
+        for (size_t i = 0; i < n_paths * dims; ++i) {
+            if (icn.from_bits(rng()) != block[i]) {
+                cout << "block_split: skip-ahead mismatch at word " << i << "\n";
+                pass = false;
+                break;
+            }
+        }
     }
     
-    // Benchmark optimized version
-    InverseCumulativeNormal icn_opt;
-    Timer timer;
+    // Moments of the normals as a sanity check
+    if (pass) {
+        double mean = 0.0, var = 0.0;
+        for (double z : per_path) { mean += z; var += z * z; }
+        mean /= per_path.size();
+        var = var / per_path.size() - mean * mean;
+        cout << "per_path mean = " << scientific << mean << ", variance = " << var << "\n";
+        pass = abs(mean) < 0.02 && abs(var - 1.0) < 0.02;
+    }
     
-    timer.start();
-    double sum_opt = 0.0;
-    for (int i = 0; i < n_calls; ++i) {
-        sum_opt += icn_opt(x_values[i]);
+    // Philox4x32-10 known answers (Random123 kat_vectors)
+    const uint32_t kat[3][10] = {
+        {0, 0, 0, 0, 0, 0, 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+        {~0u, ~0u, ~0u, ~0u, ~0u, ~0u, 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+        {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344, 0xa4093822, 0x299f31d0,
+         0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1},
+    };
+    for (const auto& v : kat) {
+        uint32_t out[4];
+        Philox4x32::bijection(v, v + 4, out);
+        if (memcmp(out, v + 6, sizeof(out)) != 0) {
+            cout << "philox: known-answer mismatch\n";
+            pass = false;
+        }
     }
-    double time_opt_ns = timer.elapsed_ns() / n_calls;
     
-    cout << fixed << setprecision(2);
-    cout << "Optimized implementation:\n";
-    cout << "  Time per call: " << time_opt_ns << " ns\n";
-    cout << "  Throughput: " << (1e9 / time_opt_ns) / 1e6 << " M calls/sec\n";
-    cout << "  (sum = " << sum_opt << " to prevent optimization)\n";
+    // Uniforms stay strictly inside (0, 1) at both ends of the word range
+    const double u_min = Philox4x32::to_uniform(0);
+    const double u_max = Philox4x32::to_uniform(~uint64_t(0));
+    if (!(u_min > 0.0 && u_max < 1.0 && isfinite(InverseCumulativeNormal()(u_max)))) {
+        cout << "to_uniform: endpoint reached (" << u_min << ", " << u_max << ")\n";
+        pass = false;
+    }
+    
+    // Sobol limits: more than MAX_DIMS dimensions, or points past 2^32 - 1,
+    // are rejected rather than clamped or read past the direction table
+    auto throws = [](auto&& f) {
+        try { f(); } catch (const exception&) { return true; }
+        return false;
+    };
+    SobolSequence last(SobolSequence::MAX_DIMS);
+    vector<double> point(SobolSequence::MAX_DIMS);
+    last.skip_to(SobolSequence::MAX_POINTS - 1);
+    last.next(point.data());
+    bool limits = !throws([&] { SobolNormals normals(SobolSequence::MAX_DIMS); })
+               && throws([] { SobolNormals normals(SobolSequence::MAX_DIMS + 1); })
+               && throws([&] { last.next(point.data()); })
+               && throws([&] { last.skip_to(SobolSequence::MAX_POINTS); });
+    if (!limits) cout << "sobol: dimension or index limit not enforced\n";
+    pass = pass && limits;
+    
+    cout << "Parallel stream test: " << (pass ? "PASS" : "FAIL") << "\n";
 }
 
-// Benchmark vector performance
-void benchmark_vector() {
-    cout << "\n=== Vector Performance Benchmark ===\n";
+// Test Latin hypercube: every stratum hit once per dimension, tiling-invariant
+void test_latin_hypercube() {
+    cout << "\n=== Latin Hypercube Test ===\n";
     
-    const int n_elements = 1000000;
-    random_device rd;
-    mt19937 gen(42);
+    const size_t n = 1000;
+    const size_t dims = 12;
+    LatinHypercubeSampler lhs(n, dims, 7);
+    
+    vector<double> full(n * dims);
+    lhs.fill(0, n, 0, dims, full.data());
+    
+    bool pass = true;
+    for (size_t d = 0; d < dims && pass; ++d) {
+        vector<int> hits(n, 0);
+        for (size_t i = 0; i < n; ++i) {
+            const size_t s = size_t(standard_normal_cdf(full[i * dims + d]) * n);
+            if (s < n) ++hits[s];
+        }
+        if (count(hits.begin(), hits.end(), 1) != int(n)) {
+            cout << "Dimension " << d << " is not a Latin hypercube column\n";
+            pass = false;
+        }
+    }
+    
+    // Streaming in odd-sized tiles must reproduce the one-shot fill
+    size_t mismatches = 0;
+    lhs.generate([&](size_t r0, size_t rows, size_t c0, size_t cols, const double* tile) {
+        for (size_t r = 0; r < rows; ++r) {
+            for (size_t c = 0; c < cols; ++c) {
+                if (tile[r * cols + c] != full[(r0 + r) * dims + c0 + c]) ++mismatches;
+            }
+        }
+    }, 77, 5);
+    if (mismatches) {
+        cout << "Tiled output differs in " << mismatches << " entries\n";
+        pass = false;
+    }
+    
+    // Stratified design keeps sample i in stratum i of dimension 0; the
+    // other dimensions are independent uniforms, so they repeat strata
+    // (a Latin column would hit each once) and are not tied to dimension 0
+    LatinHypercubeSampler strat(n, 3, 7, SamplingDesign::stratified);
+    vector<double> s(n * 3);
+    strat.fill(0, n, 0, 3, s.data());
+    for (size_t i = 0; i < n; ++i) {
+        if (size_t(standard_normal_cdf(s[i * 3]) * n) != i) {
+            cout << "Stratified sample " << i << " left its stratum\n";
+            pass = false;
+            break;
+        }
+    }
+    for (size_t d = 1; d < 3; ++d) {
+        vector<int> hits(n, 0);
+        double sum_ij = 0.0;
+        bool stratum_ok = true;
+        for (size_t i = 0; i < n; ++i) {
+            const size_t stratum = size_t(standard_normal_cdf(s[i * 3 + d]) * n);
+            if (stratum < n) ++hits[stratum];
+            stratum_ok = stratum_ok && abs(double(stratum) - double(strat.stratum(i, d))) <= 1.0;
+            sum_ij += (double(i) - 0.5 * (n - 1)) * (double(stratum) - 0.5 * (n - 1));
+        }
+        // Rank correlation with dimension 0; about 1/sqrt(n) if independent
+        const double rho = 12.0 * sum_ij / (double(n) * (double(n) * n - 1.0));
+        const bool repeats = count(hits.begin(), hits.end(), 1) != int(n);
+        if (!repeats || !stratum_ok || abs(rho) > 0.15) {
+            cout << "Stratified dimension " << d << " is not independent (rho = " << rho << ")\n";
+            pass = false;
+        }
+    }
+    
+    cout << "Latin hypercube test: " << (pass ? "PASS" : "FAIL") << "\n";
+}
+
+// Test grid quantiles against the generic path
+void test_quantile_grid() {
+    cout << "\n=== Grid Quantile Test ===\n";
+    InverseCumulativeNormal icn;
+    
+    double max_error = 0.0;
+    for (size_t n : {size_t(7), size_t(100), size_t(12345), size_t(1000000)}) {
+        for (double offset : {0.0, 0.5, 1.0}) {
+            vector<double> z(n);
+            icn.quantile_grid(n, offset, z.data());
+            for (size_t i = 0; i < n; ++i) {
+                // Upper half against the exact complement (n - i - offset) / n
+                const double x = (double(i) + offset) / double(n);
+                const double expected = (x <= 0.5) ? icn(x) : -icn((double(n - i) - offset) / double(n));
+                if (isinf(expected) || isinf(z[i])) {
+                    if (expected != z[i]) max_error = numeric_limits<double>::infinity();
+                    continue;
+                }
+                max_error = max(max_error, abs(z[i] - expected) / max(1.0, abs(expected)));
+            }
+        }
+    }
+    
+    cout << "Max relative error vs standard_value: " << scientific << max_error << "\n";
+    cout << "Grid quantile test: " << (max_error < 1e-14 ? "PASS" : "FAIL") << "\n";
+}
+
+// Test warm-started batch on sorted and nearly sorted input
+void test_warm_start() {
+    cout << "\n=== Warm-Start Batch Test ===\n";
+    InverseCumulativeNormal icn;
+    
+    const size_t n = 200000;
+    mt19937 gen(7);
     uniform_real_distribution<double> dist(1e-10, 1.0 - 1e-10);
+    vector<double> x(n), z(n);
+    for (auto& v : x) v = dist(gen);
+    sort(x.begin(), x.end());
     
-    vector<double> x_in(n_elements);
-    vector<double> z_out(n_elements);
+    // Nearly sorted: perturb every 100th neighbour pair, plus a few wild jumps
+    vector<double> nearly = x;
+    for (size_t i = 0; i + 1 < n; i += 100) swap(nearly[i], nearly[i + 1]);
+    for (size_t i = 0; i < n; i += 5000) nearly[i] = dist(gen);
     
-    for (int i = 0; i < n_elements; ++i) {
-        x_in[i] = dist(gen);
+    double max_error = 0.0;
+    for (const vector<double>* input : {&x, &nearly}) {
+        icn.warm_start(input->data(), z.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            // Upper half against the exact complement, where icn(x) itself is noisy
+            const double xi = (*input)[i];
+            const double expected = (xi <= 0.5) ? icn(xi) : -icn(1.0 - xi);
+            max_error = max(max_error, abs(z[i] - expected) / max(1.0, abs(expected)));
+        }
     }
     
+    cout << "Max relative error vs standard_value: " << scientific << max_error << "\n";
+    cout << "Warm-start test: " << (max_error < 1e-14 ? "PASS" : "FAIL") << "\n";
+}
+
+// Test log-probability inputs against the probability API and in extreme tails
+void test_log_probability() {
+    cout << "\n=== Log-Probability Input Test ===\n";
     InverseCumulativeNormal icn;
-    Timer timer;
     
-    // Measure vector overload
-    timer.start();
-    icn(x_in.data(), z_out.data(), n_elements);
-    double time_vector_ms = timer.elapsed_ms();
+    double max_error = 0.0;
+    auto track = [&](double z, double expected) {
+        max_error = max(max_error, abs(z - expected) / max(1.0, abs(expected)));
+    };
     
-    // Measure naive loop
-    timer.start();
-    for (int i = 0; i < n_elements; ++i) {
-        z_out[i] = icn(x_in[i]);
+    // Agreement with standard_value where p is representable, subnormals included
+    for (double x = 0.49; x > 1e-320; x *= 0.37) {
+        track(icn.from_log_p(log(x)), icn(x));
+        track(icn.from_log_q(log(x)), -icn(x));
     }
-    double time_naive_ms = timer.elapsed_ms();
     
-    cout << fixed << setprecision(2);
-    cout << "Vector overload: " << time_vector_ms << " ms\n";
-    cout << "Naive loop:      " << time_naive_ms << " ms\n";
-    cout << "Speedup:         " << (time_naive_ms / time_vector_ms) << "x\n";
+    // log p close to 0: p = 1 - q with q tiny
+    for (double q : {1e-3, 1e-9, 1e-20, 1e-100}) {
+        track(icn.from_log_p(log1p(-q)), -icn(q));
+    }
+    
+    // Far below DBL_MIN: check log Phi(z) = log p
+    double max_log_error = 0.0;
+    for (double log_p : {-800.0, -1e3, -1e4, -1e6, -1e12}) {
+        const double z = icn.from_log_p(log_p);
+        max_log_error = max(max_log_error, abs(log_standard_normal_cdf(z) - log_p) / abs(log_p));
+    }
+    
+    vector<double> log_p = {-1e5, -50.0, -1.0, -1e-5};
+    vector<double> batch(log_p.size());
+    icn.from_log_p(log_p.data(), batch.data(), log_p.size());
+    for (size_t i = 0; i < log_p.size(); ++i) {
+        track(batch[i], icn.from_log_p(log_p[i]));
+    }
+    
+    cout << "Max relative error vs standard_value: " << scientific << max_error << "\n";
+    cout << "Max relative log Phi error (deep tail): " << scientific << max_log_error << "\n";
+    cout << "Log-probability test: " 
+         << (max_error < 1e-14 && max_log_error < 1e-14 ? "PASS" : "FAIL") << "\n";
+}
+
+// Test survival-probability inputs: from_q(q) = Phi^{-1}(1 - q)
+void test_survival_probability() {
+    cout << "\n=== Survival Probability Input Test ===\n";
+    InverseCumulativeNormal icn;
+    
+    // q = 2^-k keeps 1 - q exact, so both APIs must agree to rounding
+    double max_error = 0.0;
+    for (int k = 1; k <= 52; ++k) {
+        const double q = ldexp(1.0, -k);
+        const double z = icn.from_q(q);
+        max_error = max(max_error, abs(z - icn(1.0 - q)) / max(1.0, abs(z)));
+    }
+    
+    // Below 1e-16, 1 - q rounds to 1; from_q keeps resolving the tail
+    bool monotone = true;
+    double prev = 0.0;
+    for (double q = 1e-3; q > 1e-300; q *= 1e-3) {
+        const double z = icn.from_q(q);
+        if (!(z > prev) || !isfinite(z)) monotone = false;
+        prev = z;
+    }
+    
+    vector<double> q = {1e-30, 1e-10, 0.25, 0.75};
+    vector<double> z(q.size());
+    icn.from_q(q.data(), z.data(), q.size());
+    for (size_t i = 0; i < q.size(); ++i) {
+        if (z[i] != -icn(q[i])) monotone = false;
+    }
+    
+    cout << "Max relative error vs standard_value(1 - q): " << scientific << max_error << "\n";
+    cout << "Survival probability test: " << (max_error < 1e-15 && monotone ? "PASS" : "FAIL") << "\n";
+}
+
+// Test raw 64-bit word conversion: finite, symmetric, monotone, consistent
+void test_from_bits() {
+    cout << "\n=== Raw Bits Input Test ===\n";
+    InverseCumulativeNormal icn;
+    
+    bool pass = true;
+    mt19937_64 gen(11);
+    vector<uint64_t> bits(100000);
+    for (auto& b : bits) b = gen();
+    bits.push_back(0);
+    bits.push_back(1);
+    bits.push_back(~uint64_t(0));
+    bits.push_back(uint64_t(1) << 63);
+    
+    double max_error = 0.0;
+    for (uint64_t b : bits) {
+        const double z = icn.from_bits(b);
+        if (!isfinite(z) || z != -icn.from_bits(~b)) pass = false;
+        
+        // Against the probability APIs at the same m = min(u, 1 - u)
+        const bool upper = (b >> 63) != 0;
+        const double m = (double(upper ? ~b : b) + 0.5) * 0x1p-64;
+        const double expected = upper ? icn.from_q(m) : icn(m);
+        max_error = max(max_error, abs(z - expected) / max(1.0, abs(expected)));
+    }
+    
+    sort(bits.begin(), bits.end());
+    vector<double> z(bits.size());
+    icn.from_bits(bits.data(), z.data(), bits.size());
+    if (!is_sorted(z.begin(), z.end())) pass = false;
+    
+    // Resolution past the 2^-53 floor of a double uniform
+    const double z_min = icn.from_bits(0);
+    cout << "from_bits(0) = " << fixed << setprecision(6) << z_min 
+         << " (double uniform floor: " << icn(0x1p-54) << ")\n";
+    if (!(z_min < icn(0x1p-54))) pass = false;
+    
+    cout << "Max relative error vs standard_value: " << scientific << max_error << "\n";
+    cout << "Raw bits test: " << (pass && max_error < 1e-15 ? "PASS" : "FAIL") << "\n";
+}
+
+// Table-driven log used for the tail seeds, against std::log
+void test_log_kernel() {
+    cout << "\n=== Log Kernel Test ===\n";
+    
+    // Error in units of the last place of the reference
+    auto ulps = [](double y) {
+        const double expected = log(y);
+        const double got = detail::log_portable(y);
+        if (expected == 0.0) return got == 0.0 ? 0.0 : numeric_limits<double>::infinity();
+        return abs(got - expected) / (nextafter(abs(expected), numeric_limits<double>::infinity()) - abs(expected));
+    };
+    
+    // Every cell in a spread of octaves: both ends, the middle, random points
+    mt19937_64 gen(5);
+    double max_ulps = 0.0;
+    const int cells = 1 << detail::LOG_TABLE_BITS;
+    for (int e : {-1074, -1060, -1022, -500, -60, -10, -2, -1, 0, 1, 2, 30, 700, 1023}) {
+        for (int i = 0; i < cells; ++i) {
+            const uint64_t start = detail::LOG_OFFSET + (uint64_t(i) << (52 - detail::LOG_TABLE_BITS));
+            const uint64_t width = uint64_t(1) << (52 - detail::LOG_TABLE_BITS);
+            vector<uint64_t> points = {start, start + 1, start + width / 2, start + width - 1};
+            for (int k = 0; k < 16; ++k) points.push_back(start + gen() % width);
+            for (uint64_t b : points) {
+                const double y = ldexp(detail::from_bits(b), e);
+                if (y > 0.0 && isfinite(y)) max_ulps = max(max_ulps, ulps(y));
+            }
+        }
+    }
+    
+    // Octave and table edges, and 1 itself where log y -> 0
+    for (int e = -1074; e <= 1023; ++e) {
+        for (double f : {1.0, 0.6875, 1.375}) {
+            const double y = ldexp(f, e);
+            if (!(y > 0.0 && isfinite(y))) continue;
+            max_ulps = max(max_ulps, ulps(y));
+            max_ulps = max(max_ulps, ulps(nextafter(y, 0.0)));
+            max_ulps = max(max_ulps, ulps(nextafter(y, numeric_limits<double>::infinity())));
+        }
+    }
+    max_ulps = max(max_ulps, ulps(numeric_limits<double>::max()));
+    max_ulps = max(max_ulps, ulps(numeric_limits<double>::denorm_min()));
+    
+    cout << "Max error vs std::log: " << fixed << setprecision(3) << max_ulps << " ulp\n";
+    cout << "Log kernel test: " << (max_ulps <= 1.0 ? "PASS" : "FAIL") << "\n";
+}
+
+// Test table-driven probit for 16- and 32-bit codes
+void test_quantized() {
+    cout << "\n=== Quantized Uniform Test ===\n";
+    QuantizedInverseCumulativeNormal qicn;
+    
+    bool exact16 = true;
+    for (uint32_t c = 0; c < 65536; ++c) {
+        if (qicn.from_u16(uint16_t(c)) != InverseCumulativeNormal::standard_value((c + 0.5) * 0x1p-16)) {
+            exact16 = false;
+        }
+    }
+    
+    // Random codes plus every octave boundary in both halves
+    mt19937 gen(5);
+    vector<uint32_t> codes(200000);
+    for (auto& c : codes) c = uint32_t(gen());
+    for (int b = 0; b < 32; ++b) {
+        const uint32_t edge = uint32_t(1) << b;
+        for (uint32_t c : {edge - 1, edge, edge + 1}) {
+            codes.push_back(c);
+            codes.push_back(~c);
+        }
+    }
+    
+    vector<double> z(codes.size());
+    qicn.from_u32(codes.data(), z.data(), codes.size());
+    double max_error = 0.0;
+    for (size_t i = 0; i < codes.size(); ++i) {
+        const double expected = InverseCumulativeNormal::standard_value((codes[i] + 0.5) * 0x1p-32);
+        max_error = max(max_error, abs(z[i] - expected) / max(1.0, abs(expected)));
+    }
+    
+    cout << "16-bit table exact: " << (exact16 ? "yes" : "no") << "\n";
+    cout << "32-bit max relative error: " << scientific << max_error << "\n";
+    cout << "Quantized test: " << (exact16 && max_error < 1e-15 ? "PASS" : "FAIL") << "\n";
+}
+
+// Test the segmented engine against standard_value() across octave and cell edges
+void test_segmented() {
+    cout << "\n=== Segmented Engine Test ===\n";
+    InverseCumulativeNormal icn;
+    
+    // Uniform x, log-uniform tail m in both halves, and both sides of every
+    // octave and cell boundary
+    mt19937 gen(6);
+    uniform_real_distribution<double> uniform(0.0, 1.0);
+    uniform_real_distribution<double> log_m(-64.0 * log(2.0), log(0.5));
+    vector<double> x;
+    for (int i = 0; i < 200000; ++i) x.push_back(uniform(gen));
+    for (int i = 0; i < 100000; ++i) {
+        const double m = exp(log_m(gen));
+        x.push_back(m);
+        x.push_back(1.0 - m);
+    }
+    for (int e = 2; e <= 64; ++e) {
+        for (int j = 0; j < 8; ++j) {
+            const double edge = ldexp(1.0 + j / 8.0, -e);
+            x.push_back(nextafter(edge, 0.0));
+            x.push_back(edge);
+        }
+    }
+    
+    vector<double> z(x.size());
+    icn.segmented(x.data(), z.data(), x.size());
+    double max_error = 0.0;
+    bool batch_matches = true;
+    for (size_t i = 0; i < x.size(); ++i) {
+        const double expected = InverseCumulativeNormal::standard_value(x[i]);
+        max_error = max(max_error, abs(z[i] - expected) / max(1.0, abs(expected)));
+        if (z[i] != InverseCumulativeNormal::segmented_value(x[i])) batch_matches = false;
+    }
+    
+    // Edges and the fallback below 2^-64
+    const bool edges = icn.segmented(0.5) == 0.0
+        && icn.segmented(0.0) == -numeric_limits<double>::infinity()
+        && icn.segmented(1.0) == numeric_limits<double>::infinity()
+        && icn.segmented(1e-300) == icn(1e-300);
+    
+    cout << "Max relative error vs standard_value: " << scientific << max_error << "\n";
+    cout << "Batch matches scalar: " << (batch_matches ? "yes" : "no") << "\n";
+    cout << "Segmented test: " << (max_error < 1e-15 && batch_matches && edges ? "PASS" : "FAIL") << "\n";
+}
+
+// Test deduplicated and cached quantiles against the generic batch
+void test_quantile_cache() {
+    cout << "\n=== Quantile Cache Test ===\n";
+    InverseCumulativeNormal icn(0.0, 20000.0);
+    
+    // Many positions sharing a few confidence levels
+    const double levels[] = {0.05, 0.01, 0.005, 0.001};
+    mt19937 gen(7);
+    vector<double> x(100000);
+    for (auto& v : x) v = levels[gen() % 4];
+    
+    vector<double> expected(x.size()), z(x.size());
+    icn(x.data(), expected.data(), x.size());
+    
+    deduplicated(icn, x.data(), z.data(), x.size());
+    bool dedup_exact = z == expected;
+    
+    QuantileCache cache(icn, 16);
+    cache(x.data(), z.data(), x.size());
+    bool cache_exact = z == expected;
+    const size_t entries = cache.size();
+    cache(x.data(), z.data(), x.size());
+    cache_exact = cache_exact && z == expected && cache.size() == entries;
+    
+    // More distinct values than the table holds: still exact, table stays bounded
+    uniform_real_distribution<double> dist(0.0, 1.0);
+    for (auto& v : x) v = dist(gen);
+    icn(x.data(), expected.data(), x.size());
+    cache(x.data(), z.data(), x.size());
+    const bool overflow_exact = z == expected && cache.size() == 16;
+    
+    cout << "Distinct levels cached: " << entries << "\n";
+    cout << "Quantile cache test: " << (dedup_exact && cache_exact && entries == 4 && overflow_exact ? "PASS" : "FAIL") << "\n";
+}
+
+#if defined(QUANT_ENABLE_CONSTEXPR)
+// Quantiles evaluated at compile time must match the runtime path bit for bit
+constexpr double CONSTEXPR_X[] = {
+    1e-300, 1e-100, 1e-20, 1e-9, 1e-5, 0.001, 0.01, 0.025, 0.05, 0.1, 0.3, 0.5,
+    0.7, 0.9, 0.95, 0.975, 0.99, 0.995, 0.999, 1.0 - 1e-9, 1.0 - 1e-15
+};
+constexpr size_t CONSTEXPR_N = sizeof(CONSTEXPR_X) / sizeof(CONSTEXPR_X[0]);
+
+struct ConstexprQuantiles {
+    double z[CONSTEXPR_N];
+};
+
+constexpr ConstexprQuantiles constexpr_quantiles() {
+    ConstexprQuantiles q{};
+    constexpr InverseCumulativeNormal icn;
+    for (size_t i = 0; i < CONSTEXPR_N; ++i) {
+        q.z[i] = icn(CONSTEXPR_X[i]);
+    }
+    return q;
+}
+
+// Test compile-time quantiles against the same calls at run time
+void test_constexpr() {
+    cout << "\n=== Compile-Time Quantile Test ===\n";
+    constexpr InverseCumulativeNormal icn;
+    constexpr double z975 = icn(0.975);
+    static_assert(z975 > 1.959963984 && z975 < 1.959963985, "Phi^-1(0.975)");
+    static_assert(InverseCumulativeNormal::standard_value(0.5) == 0.0, "Phi^-1(0.5)");
+    
+    constexpr ConstexprQuantiles q = constexpr_quantiles();
+    volatile double one = 1.0;  // keeps the runtime calls at runtime
+    size_t mismatches = 0;
+    for (size_t i = 0; i < CONSTEXPR_N; ++i) {
+        if (icn(CONSTEXPR_X[i] * one) != q.z[i]) ++mismatches;
+    }
+    
+    cout << "Phi^-1(0.975) = " << setprecision(17) << z975 << "\n";
+    cout << "Runtime mismatches: " << mismatches << " of " << CONSTEXPR_N << "\n";
+    cout << "Compile-time test: " << (mismatches == 0 ? "PASS" : "FAIL") << "\n";
+}
+#endif
+
+// Per-element and broadcast (mu, sigma) transforms against scalar calls
+void test_transform() {
+    cout << "\n=== Parameter Transform Test ===\n";
+    const size_t n = 1000;
+    mt19937 gen(11);
+    uniform_real_distribution<double> prob(0.0, 1.0), loc(-100.0, 100.0), scale(0.1, 50.0);
+    vector<double> x(n), mu(n), sigma(n), z(n), z_broadcast(n), x_broadcast(n, 0.975);
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = prob(gen);
+        mu[i] = loc(gen);
+        sigma[i] = scale(gen);
+    }
+    
+    InverseCumulativeNormal icn;
+    icn.transform(x.data(), mu.data(), sigma.data(), z.data(), n);
+    double max_error = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        const double expected = InverseCumulativeNormal(mu[i], sigma[i])(x[i]);
+        max_error = max(max_error, abs(z[i] - expected) / max(1.0, abs(expected)));
+    }
+    
+    // One probability against many parameters matches the per-element form
+    icn.transform(0.975, mu.data(), sigma.data(), z_broadcast.data(), n);
+    icn.transform(x_broadcast.data(), mu.data(), sigma.data(), z.data(), n);
+    const bool broadcast_exact = z_broadcast == z;
+    
+    cout << "Max relative error vs per-element objects: " << scientific << setprecision(6) << max_error << "\n";
+    cout << "Parameter transform test: " << (max_error < 1e-14 && broadcast_exact ? "PASS" : "FAIL") << "\n";
+}
+
+// Test the quantile matrix against one broadcast transform per level
+void test_quantile_matrix() {
+    cout << "\n=== Quantile Matrix Test ===\n";
+    const double levels[] = {0.95, 0.99, 0.995, 0.999, 0.01};
+    const size_t n_levels = 5;
+    mt19937 gen(5);
+    uniform_real_distribution<double> loc(-1e6, 1e6), scale(1.0, 1e5);
+    InverseCumulativeNormal icn;
+    
+    // Not a multiple of the column block; the second size is large enough for
+    // non-temporal stores, with odd rows so they start off 32-byte alignment
+    bool exact = true;
+    for (size_t n : {size_t(1300), size_t(210001)}) {
+        vector<double> mu(n), sigma(n), matrix(n_levels * n), row(n);
+        for (size_t i = 0; i < n; ++i) {
+            mu[i] = loc(gen);
+            sigma[i] = scale(gen);
+        }
+        icn.quantile_matrix(levels, n_levels, mu.data(), sigma.data(), n, matrix.data());
+        for (size_t k = 0; k < n_levels; ++k) {
+            icn.transform(levels[k], mu.data(), sigma.data(), row.data(), n);
+            exact = exact && equal(row.begin(), row.end(), matrix.begin() + k * n);
+        }
+    }
+    
+    cout << "Quantile matrix test: " << (exact ? "PASS" : "FAIL") << "\n";
+}
+
+// Test strided and indexed batches against scalar calls on an array of structs
+void test_strided_indexed() {
+    cout << "\n=== Strided and Indexed Batch Test ===\n";
+    struct Scenario { double u, shock, weight; };
+    const size_t n = 1000;
+    mt19937 gen(9);
+    uniform_real_distribution<double> dist(0.0, 1.0);
+    vector<Scenario> scenarios(n);
+    for (auto& s : scenarios) s = {dist(gen), -1.0, dist(gen)};
+    
+    // Read u and write shock in place, leaving the other fields alone
+    InverseCumulativeNormal icn(0.5, 2.0);
+    icn(&scenarios[0].u, 3, &scenarios[0].shock, 3, n);
+    bool strided_exact = true;
+    for (const auto& s : scenarios) {
+        strided_exact = strided_exact && s.shock == icn(s.u);
+    }
+    
+    // Every third row only; the rest of out keeps its sentinel
+    vector<double> x(n), z(n, -1.0);
+    vector<size_t> index;
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = dist(gen);
+        if (i % 3 == 0) index.push_back(i);
+    }
+    icn(x.data(), index.data(), z.data(), index.size());
+    bool indexed_exact = true;
+    for (size_t i = 0; i < n; ++i) {
+        indexed_exact = indexed_exact && z[i] == (i % 3 == 0 ? icn(x[i]) : -1.0);
+    }
+    
+    cout << "Strided and indexed batch test: " << (strided_exact && indexed_exact ? "PASS" : "FAIL") << "\n";
+}
+
+// Test tile streaming against one full batch, in order and within capacity
+void test_generate_tiles() {
+    cout << "\n=== Tile Streaming Test ===\n";
+    const size_t n = 10000;
+    vector<double> x(n), expected(n);
+    for (size_t i = 0; i < n; ++i) x[i] = (i + 0.5) / n;
+    InverseCumulativeNormal icn(1.0, 3.0);
+    icn(x.data(), expected.data(), n);
+    
+    // Odd tile size, and one above the cap: the source is never asked for
+    // more than fits and the consumer sees the batch in order
+    bool exact = true;
+    for (size_t tile_size : {size_t(700), size_t(1) << 20}) {
+        size_t produced = 0, consumed = 0, max_tile = 0;
+        icn.generate_tiles(n,
+            [&](double* tile, size_t m) {
+                copy(x.begin() + produced, x.begin() + produced + m, tile);
+                produced += m;
+                max_tile = max(max_tile, m);
+            },
+            tile_size,
+            [&](const double* tile, size_t m) {
+                exact = exact && equal(tile, tile + m, expected.begin() + consumed);
+                consumed += m;
+            });
+        exact = exact && produced == n && consumed == n && max_tile <= min(tile_size, size_t(2048));
+    }
+    
+    cout << "Tile streaming test: " << (exact ? "PASS" : "FAIL") << "\n";
+}
+
+// Test Phi, Q and log Phi: round trips, tails and batch against scalar
+void test_cumulative_normal() {
+    cout << "\n=== Cumulative Normal Test ===\n";
+    CumulativeNormal cdf;
+    InverseCumulativeNormal icn;
+    
+    // Phi(Phi^-1(x)) across the inverse's range, relative to the smaller tail
+    double max_roundtrip = 0.0;
+    for (double x = 1e-300; x < 0.5; x *= 1.37) {
+        max_roundtrip = max(max_roundtrip, abs(cdf(icn(x)) - x) / x);
+        max_roundtrip = max(max_roundtrip, abs(cdf.complement(icn.from_q(x)) - x) / x);
+    }
+    
+    // log Phi against log(Phi) where Phi is representable, and against the
+    // inverse's log-probability entry point far beyond it
+    double max_log_error = 0.0;
+    for (double z = -30.0; z <= 8.0; z += 0.01) {
+        const double expected = z > 0.0 ? log1p(-0.5 * erfc(z / sqrt(2.0))) : log(0.5 * erfc(-z / sqrt(2.0)));
+        max_log_error = max(max_log_error, abs(cdf.log_value(z) - expected) / abs(expected));
+    }
+    for (double log_p = -1e5; log_p < -700.0; log_p *= 0.9) {
+        max_log_error = max(max_log_error, abs(cdf.log_value(icn.from_log_p(log_p)) - log_p) / -log_p);
+    }
+    
+    // Batch and location-scale forms match the scalar standard ones
+    CumulativeNormal shifted(2.0, 0.5);
+    vector<double> x = {-3.0, 0.0, 1.75, 2.0, 4.5}, y(x.size()), q(x.size()), log_y(x.size());
+    shifted(x.data(), y.data(), x.size());
+    shifted.complement(x.data(), q.data(), x.size());
+    shifted.log_value(x.data(), log_y.data(), x.size());
+    bool consistent = true;
+    for (size_t i = 0; i < x.size(); ++i) {
+        const double z = (x[i] - 2.0) / 0.5;
+        const double density = 2.0 * exp(-0.5 * z * z) / sqrt(2.0 * M_PI);
+        consistent = consistent && y[i] == CumulativeNormal::standard_value(z)
+                  && q[i] == CumulativeNormal::standard_complement(z)
+                  && log_y[i] == CumulativeNormal::standard_log_value(z)
+                  && abs(shifted.density(x[i]) - density) <= 1e-15 * density;
+    }
+    
+    // The region-split batch is bit-identical to the scalar calls across
+    // every erfc region boundary, the saturated tails and NaN
+    vector<double> sweep;
+    for (double v = -45.0; v <= 45.0; v += 0.0037) sweep.push_back(v);
+    for (double v : {0.0, -0.0, 1.193242693252049, 1.767766952966369, 4.040610178208842, 8.48528137423857,
+                     36.76955262170047, 39.59797974644666, numeric_limits<double>::infinity(),
+                     -numeric_limits<double>::infinity(), numeric_limits<double>::quiet_NaN()}) {
+        sweep.push_back(v);
+        sweep.push_back(-v);
+        sweep.push_back(nextafter(v, 0.0));
+    }
+    vector<double> sweep_p(sweep.size()), sweep_q(sweep.size());
+    cdf(sweep.data(), sweep_p.data(), sweep.size());
+    cdf.complement(sweep.data(), sweep_q.data(), sweep.size());
+    auto same = [](double a, double b) { return detail::bits_of(a) == detail::bits_of(b) || (a != a && b != b); };
+    for (size_t i = 0; i < sweep.size(); ++i) {
+        consistent = consistent && same(sweep_p[i], CumulativeNormal::standard_value(sweep[i]))
+                  && same(sweep_q[i], CumulativeNormal::standard_complement(sweep[i]));
+    }
+    
+#if defined(QUANT_ENABLE_CONSTEXPR)
+    static_assert(CumulativeNormal()(0.0) == 0.5, "Phi(0) folds at compile time");
+#endif
+    
+    cout << "Max Phi(Phi^-1(x)) relative error: " << scientific << setprecision(6) << max_roundtrip << "\n";
+    cout << "Max relative log Phi error: " << scientific << max_log_error << "\n";
+    cout << "Cumulative normal test: " << (max_roundtrip < 1e-12 && max_log_error < 1e-13 && consistent ? "PASS" : "FAIL") << "\n";
+}
+
+// Test the joint quantile and density against operator() and phi(z)
+void test_quantile_and_density() {
+    cout << "\n=== Quantile and Density Test ===\n";
+    InverseCumulativeNormal icn(0.5, 2.0);
+    
+    // z matches operator() exactly; pdf against phi(z) evaluated in long double.
+    // Near |z| = 37 the rounding of z alone moves phi by z^2 ulp ~ 1e-13.
+    bool z_exact = true;
+    double max_pdf_error = 0.0, max_second_error = 0.0;
+    vector<double> x;
+    for (double v = 1e-300; v < 0.5; v *= 1.9) {
+        x.push_back(v);
+        x.push_back(1.0 - v);
+    }
+    vector<double> z(x.size()), pdf(x.size()), dz(x.size()), d2z(x.size());
+    icn.quantile_and_density(x.data(), z.data(), pdf.data(), x.size());
+    icn.quantile_derivatives(x.data(), z.data(), dz.data(), d2z.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        const long double s = (static_cast<long double>(z[i]) - 0.5L) / 2.0L;
+        const long double expected = expl(-0.5L * s * s) / sqrtl(2.0L * M_PI) / 2.0L;
+        z_exact = z_exact && z[i] == icn(x[i]);
+        max_pdf_error = max(max_pdf_error, double(fabsl(pdf[i] - expected) / expected));
+        max_pdf_error = max(max_pdf_error, double(fabsl(1.0L / dz[i] - expected) / expected));
+        
+        // d2z/dx2 = sigma z_std / phi^2 = s / (sigma pdf^2)
+        const long double second = s / (2.0L * expected * expected);
+        if (s != 0.0L && fabsl(second) < numeric_limits<double>::max()) max_second_error = max(max_second_error, double(fabsl(d2z[i] - second) / fabsl(second)));
+    }
+    
+    cout << "Max relative density error: " << scientific << setprecision(6) << max_pdf_error << "\n";
+    cout << "Max relative second derivative error: " << scientific << max_second_error << "\n";
+    cout << "Quantile and density test: " << (z_exact && max_pdf_error < 1e-12 && max_second_error < 1e-12 ? "PASS" : "FAIL") << "\n";
+}
+
+// Test forward duals and the adjoint sweep against each other and finite differences
+void test_probit_ad() {
+    cout << "\n=== Probit AD Test ===\n";
+    InverseCumulativeNormal icn(1.0, 0.3);
+    
+    // Loss L = sum_i w_i z_i^2: reverse sweep against forward duals, one
+    // direction per input
+    const size_t n = 64;
+    vector<double> x(n), w(n), z(n), dz_dx(n), z_bar(n), x_bar(n, 0.0);
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = (i + 0.5) / n;
+        w[i] = 1.0 + 0.1 * i;
+    }
+    quantile_forward(icn, x.data(), z.data(), dz_dx.data(), n);
+    for (size_t i = 0; i < n; ++i) z_bar[i] = 2.0 * w[i] * z[i];
+    quantile_adjoint(z_bar.data(), dz_dx.data(), x_bar.data(), n);
+    
+    double max_error = 0.0, max_fd_error = 0.0;
+    bool values_exact = true;
+    for (size_t i = 0; i < n; ++i) {
+        const Dual zd = quantile(icn, Dual{x[i], 1.0});
+        ProbitNode node;
+        values_exact = values_exact && zd.value == icn(x[i]) && node.record(icn, x[i]) == zd.value;
+        max_error = max(max_error, abs(x_bar[i] - 2.0 * w[i] * zd.value * zd.tangent) / abs(x_bar[i]));
+        max_error = max(max_error, abs(node.adjoint(z_bar[i]) - x_bar[i]) / abs(x_bar[i]));
+        
+        // Central difference on the probit itself
+        const double h = 1e-6 * min(x[i], 1.0 - x[i]);
+        const double fd = (icn(x[i] + h) - icn(x[i] - h)) / (2.0 * h);
+        max_fd_error = max(max_fd_error, abs(zd.tangent - fd) / fd);
+    }
+    
+#if defined(QUANT_ENABLE_CONSTEXPR)
+    constexpr Dual median = quantile(InverseCumulativeNormal(), Dual{0.5, 1.0});
+    static_assert(median.value == 0.0, "dual probit folds at compile time");
+#else
+    const Dual median = quantile(InverseCumulativeNormal(), Dual{0.5, 1.0});
+#endif
+    const bool median_ok = abs(median.tangent - sqrt(2.0 * M_PI)) < 1e-15 * sqrt(2.0 * M_PI);
+    
+    cout << "Max relative adjoint error: " << scientific << setprecision(6) << max_error << "\n";
+    cout << "Max relative finite-difference error: " << max_fd_error << "\n";
+    cout << "Probit AD test: " << (values_exact && median_ok && max_error < 1e-14 && max_fd_error < 1e-6 ? "PASS" : "FAIL") << "\n";
+}
+
+// Test Student-t quantiles against high-precision references
+void test_student_t() {
+    cout << "\n=== Student-t Quantile Test ===\n";
+    
+    // Reference quantiles from 50-digit incomplete beta inversion: closed
+    // forms (nu = 1, 4), the Halley iteration, and Cornish-Fisher (nu = 1000).
+    // At p = 1e-300 rounding in log F alone is worth |log p| ulp / nu in t.
+    struct Reference { double nu, p, t; };
+    const Reference references[] = {
+        {0.5, 0.01, -1028.491010471621872904477},
+        {0.7, 0.2, -1.758826731403458995886652},
+        {1.0, 1e-30, -3.18309886183790645010961e+29},
+        {1.0, 0.9, 3.077683537175254133078953},
+        {1.5, 1e-300, -5.21946942734463632936172e+199},
+        {1.5, 0.3, -0.6517954826023570964650417},
+        {3.0, 1e-6, -103.2994677804193442994828},
+        {3.0, 0.999, 10.21453185240738345649836},
+        {4.0, 1e-30, -41617914.50287813121936194},
+        {4.0, 0.3, -0.5686490630497054801097781},
+        {7.5, 0.01, -2.94309932340672198184918},
+        {30.0, 1e-300, -50178575360.50508071436707},
+        {30.0, 0.9, 1.310415025391395711218388},
+        {1000.0, 1e-30, -11.85433310408448240349301},
+        {1000.0, 0.01, -2.330082674755512974019582},
+    };
+    
+    double max_error = 0.0;
+    for (const auto& r : references) {
+        const double t = InverseCumulativeStudentT(r.nu)(r.p);
+        max_error = max(max_error, abs(t - r.t) / abs(r.t));
+    }
+    
+    // Batch and location-scale form against the scalar standard quantile
+    InverseCumulativeStudentT student(5.0, 0.01, 0.2);
+    vector<double> x = {1e-12, 0.025, 0.5, 0.975, 1.0 - 1e-12}, y(x.size());
+    student(x.data(), y.data(), x.size());
+    bool consistent = y[2] == 0.01;
+    for (size_t i = 0; i < x.size(); ++i) {
+        consistent = consistent && y[i] == 0.01 + 0.2 * student.standard_value(x[i]);
+    }
+    
+    // Non-positive and NaN degrees of freedom are rejected
+    for (double bad_nu : {0.0, -3.0, numeric_limits<double>::quiet_NaN()}) {
+        try {
+            InverseCumulativeStudentT rejected(bad_nu);
+            consistent = false;
+        } catch (const invalid_argument&) {}
+    }
+    
+    cout << "Max relative error vs reference: " << scientific << setprecision(6) << max_error << "\n";
+    cout << "Student-t quantile test: " << (max_error < 1e-12 && consistent ? "PASS" : "FAIL") << "\n";
+}
+
+// Test gamma quantiles against high-precision references
+void test_gamma() {
+    cout << "\n=== Gamma Quantile Test ===\n";
+    
+    // Reference quantiles from 50-digit incomplete gamma inversion
+    struct Reference { double shape, p, x; };
+    const Reference references[] = {
+        {0.05, 0.05, 5.573875481878781911529085e-27},
+        {0.05, 0.999, 2.736458598728675592046514},
+        {0.3, 1e-20, 1.502222481645821016389752e-67},
+        {0.3, 0.7, 0.2565649133210520873878102},
+        {1.0, 1e-300, 1.000000000000000025059092e-300},
+        {2.5, 0.05, 0.572738113030884640066881},
+        {2.5, 1.0 - 1e-8, 22.89729355618131189478937},
+        {30.0, 1e-300, 1.204449703859961137435042e-9},
+        {30.0, 0.999, 49.80361653492468671371023},
+        {250.0, 1e-20, 130.4144902949224932271673},
+        {1e4, 0.7, 10052.19740533165178886335},
+        {1e6, 1e-300, 963408.6539398657030368634},
+        {1e6, 1.0 - 1e-8, 1005622.169910463633127821},
+    };
+    
+    double max_error = 0.0;
+    for (const auto& r : references) {
+        const double x = InverseCumulativeGamma(r.shape)(r.p);
+        max_error = max(max_error, abs(x - r.x) / r.x);
+    }
+    
+    // Chi-square with 2 degrees of freedom is exponential with mean 2
+    const auto chi2 = InverseCumulativeGamma::chi_square(2.0);
+    for (double p : {1e-10, 0.1, 0.5, 0.9, 0.999}) {
+        max_error = max(max_error, abs(chi2(p) + 2.0 * log1p(-p)) / (-2.0 * log1p(-p)));
+    }
+    
+    // Batch and mixed-shape batch against the scalar objects
+    const size_t n = 600;
+    vector<double> x(n), shape(n), y(n), y_mixed(n);
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = (i + 0.5) / n;
+        shape[i] = i < 300 ? 3.0 : 0.5 + (i % 7);
+    }
+    InverseCumulativeGamma gamma3(3.0, 2.5);
+    gamma3(x.data(), y.data(), n);
+    InverseCumulativeGamma::quantiles_by_shape(x.data(), shape.data(), y_mixed.data(), n);
+    bool consistent = true;
+    for (size_t i = 0; i < n; ++i) {
+        consistent = consistent && y[i] == gamma3(x[i])
+                  && y_mixed[i] == InverseCumulativeGamma(shape[i])(x[i]);
+    }
+    
+    // Non-positive and NaN shapes are rejected, per element as well
+    for (double bad_shape : {0.0, -1.0, numeric_limits<double>::quiet_NaN()}) {
+        try {
+            InverseCumulativeGamma rejected(bad_shape);
+            consistent = false;
+        } catch (const invalid_argument&) {}
+        try {
+            InverseCumulativeGamma::quantiles_by_shape(x.data(), &bad_shape, y.data(), 1);
+            consistent = false;
+        } catch (const invalid_argument&) {}
+    }
+    
+    cout << "Max relative error vs reference: " << scientific << setprecision(6) << max_error << "\n";
+    cout << "Gamma quantile test: " << (max_error < 1e-13 && consistent ? "PASS" : "FAIL") << "\n";
+}
+
+// Test truncated normal samples against high-precision references
+void test_truncated_normal() {
+    cout << "\n=== Truncated Normal Test ===\n";
+    
+    // References: Phi^{-1}(Phi(a) + u (Phi(b) - Phi(a))) at 800 digits
+    const double inf = numeric_limits<double>::infinity();
+    struct Reference { double lower, upper, u, z; };
+    const Reference references[] = {
+        {-1.0, 2.0, 0.3, 0.617876073011408805633525},
+        {-0.5, 0.5, 0.75, 0.2423131324466763728821785},
+        {0.0, inf, 0.25, 1.150349380376008178296765},
+        {8.0, inf, 0.5, 8.084911007391544102381064},
+        {30.0, 31.0, 0.9, 30.00350792324417702756861},
+        {38.0, 40.0, 0.2, 38.04230084748545303883971},
+        {-40.0, -39.0, 0.1, -39.05895739732947140942361},
+        {-60.0, -59.9, 0.5, -59.91152595196461852033571},
+        {-inf, -50.0, 0.7, -50.00713014091326013945724},
+        {5.0, 5.000001, 0.4, 5.000000599999400083602591},
+        {-3.0, -2.0, 1e-12, -2.999999999995171262207717},
+        {10.0, 12.0, 0.999999, 10.00000009902864548483927},
+    };
+    
+    double max_error = 0.0;
+    bool consistent = true;
+    for (const auto& r : references) {
+        TruncatedNormal tn(r.lower, r.upper);
+        const double z = tn(r.u);
+        max_error = max(max_error, abs(z - r.z) / abs(r.z));
+        
+        // Batch matches scalar, and samples stay inside the bounds
+        double u[3] = {r.u, 1e-300, 1.0 - 1e-16}, y[3];
+        tn(u, y, 3);
+        for (int i = 0; i < 3; ++i) {
+            consistent = consistent && y[i] == tn(u[i]) && y[i] >= r.lower && y[i] <= r.upper;
+        }
+    }
+    
+    // Location and scale: bounds are in the same units as the samples
+    TruncatedNormal shifted(1.0 + 2.0 * 30.0, 1.0 + 2.0 * 31.0, 1.0, 2.0);
+    consistent = consistent && abs(shifted(0.9) - (1.0 + 2.0 * 30.00350792324417702756861)) < 1e-12;
+    
+    // Inverted, empty and NaN intervals are rejected
+    const double nan = numeric_limits<double>::quiet_NaN();
+    const double bad_bounds[4][2] = {{2.0, 1.0}, {1.0, 1.0}, {inf, inf}, {nan, 1.0}};
+    for (const auto& bounds : bad_bounds) {
+        try {
+            TruncatedNormal rejected(bounds[0], bounds[1]);
+            consistent = false;
+        } catch (const invalid_argument&) {}
+    }
+    
+    cout << "Max relative error vs reference: " << scientific << setprecision(6) << max_error << "\n";
+    cout << "Truncated normal test: " << (max_error < 1e-14 && consistent ? "PASS" : "FAIL") << "\n";
+}
+
+// Test copula correlation, default rates and tiling/thread invariance
+void test_gaussian_copula() {
+    cout << "\n=== Gaussian Copula Test ===\n";
+    
+    const double correlation[9] = {
+        1.0, 0.6, -0.3,
+        0.6, 1.0, 0.2,
+        -0.3, 0.2, 1.0,
+    };
+    const auto copula = GaussianCopula::from_correlation(correlation, 3, 7);
+    
+    // Sample correlation of the normals against the target
+    const size_t n = 200000;
+    vector<double> x(n * 3);
+    copula.fill_normals(0, n, 0, 3, x.data());
+    double max_corr_error = 0.0;
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            double sum = 0.0;
+            for (size_t s = 0; s < n; ++s) sum += x[s * 3 + i] * x[s * 3 + j];
+            max_corr_error = max(max_corr_error, abs(sum / n - correlation[i * 3 + j]));
+        }
+    }
+    
+    // Uniforms through generate_normals() match a single fill for any thread
+    // count, and every tile of generate_marginals() matches the full fill
+    vector<double> u(n * 3), u_threaded(n * 3);
+    copula.fill(0, n, u.data());
+    generate_normals(copula, n, u_threaded.data(), 4, 1000);
+    bool consistent = u == u_threaded;
+    for (size_t k = 0; k < n * 3; ++k) {
+        consistent = consistent && u[k] == CumulativeNormal()(x[k]);
+    }
+    copula.generate_marginals(n, [](size_t, double v) { return -log1p(-v); },
+        [&](size_t r0, size_t rows, size_t c0, size_t cols, const double* tile) {
+            for (size_t r = 0; r < rows; ++r) {
+                for (size_t c = 0; c < cols; ++c) {
+                    consistent = consistent && tile[r * cols + c] == -log1p(-u[(r0 + r) * 3 + c0 + c]);
+                }
+            }
+        }, 777, 2);
+    
+    // One-factor model: default frequency at the Phi^{-1}(PD) threshold
+    const double loading = sqrt(0.2), pd = 0.05;
+    GaussianCopula one_factor(&loading, 1, 1, 11);
+    double threshold = 0.0;
+    GaussianCopula::thresholds(&pd, &threshold, 1);
+    size_t defaults = 0;
+    one_factor.generate(n, [&](size_t, size_t rows, size_t, size_t, const double* tile) {
+        for (size_t r = 0; r < rows; ++r) defaults += tile[r] < pd;
+    });
+    const double default_rate = double(defaults) / n;
+    consistent = consistent && threshold == InverseCumulativeNormal()(pd);
+    
+    // Loadings past the unit ball, non-unit diagonals and indefinite
+    // matrices are rejected rather than clipped
+    auto rejected = [](auto&& make) {
+        try { make(); } catch (const invalid_argument&) { return true; }
+        return false;
+    };
+    const double too_long[2] = {0.8, 0.7};
+    const double scaled[4] = {2.0, 0.5, 0.5, 1.0};
+    const double indefinite[9] = {
+        1.0, 0.9, -0.9,
+        0.9, 1.0, 0.9,
+        -0.9, 0.9, 1.0,
+    };
+    consistent = consistent && rejected([&] { GaussianCopula(too_long, 1, 2, 3); })
+              && rejected([&] { GaussianCopula::from_correlation(scaled, 2, 3); })
+              && rejected([&] { GaussianCopula::from_correlation(indefinite, 3, 3); });
+    
+    cout << "Max correlation error: " << scientific << setprecision(6) << max_corr_error << "\n";
+    cout << "Default rate (PD 0.05): " << fixed << setprecision(4) << default_rate << "\n";
+    bool passed = max_corr_error < 0.01 && abs(default_rate - pd) < 0.003 && consistent;
+    cout << "Gaussian copula test: " << (passed ? "PASS" : "FAIL") << "\n";
+}
+
+// Test the Vasicek engine against the Basel formula and the large-pool loss CDF
+void test_vasicek_loss() {
+    cout << "\n=== Vasicek Loss Test ===\n";
+    
+    // Homogeneous pool: 100 obligors, PD 1%, rho 12%, unit total exposure
+    const size_t n = 100;
+    const double pd = 0.01, rho = 0.12;
+    vector<double> pds(n, pd), exposure(n, 1.0 / n), rhos(n, rho);
+    const auto engine = VasicekLossEngine::one_factor(pds.data(), exposure.data(), rhos.data(), n);
+    InverseCumulativeNormal icn;
+    CumulativeNormal cdf;
+    
+    // Basel IRB conditional PD at the 99.9% factor quantile
+    const double y999 = -icn(0.999);
+    vector<double> p(n);
+    engine.conditional_pd(&y999, p.data());
+    const double basel = cdf((icn(pd) + sqrt(rho) * icn(0.999)) / sqrt(1.0 - rho));
+    double max_error = abs(p[0] - basel) / basel;
+    
+    // Two factors collapse to one along the loading direction
+    const double loadings2[2] = {0.3, 0.2}, y2[2] = {-1.5, 0.7};
+    const double b = sqrt(0.13), y1 = (0.3 * y2[0] + 0.2 * y2[1]) / b;
+    double p2 = 0.0, p1 = 0.0;
+    VasicekLossEngine(&pd, exposure.data(), loadings2, 1, 2).conditional_pd(y2, &p2);
+    VasicekLossEngine(&pd, exposure.data(), &b, 1, 1).conditional_pd(&y1, &p1);
+    max_error = max(max_error, abs(p2 - p1) / p1);
+    
+    // Loss distribution over a midpoint quantile grid of the factor against
+    // Vasicek's large-pool CDF
+    // P(L <= x) = Phi((sqrt(1 - rho) Phi^{-1}(x) - Phi^{-1}(PD)) / sqrt(rho))
+    const size_t scenarios = 100000, bins = 50;
+    const double width = 0.002;
+    vector<double> y(scenarios), losses(scenarios), losses_threaded(scenarios);
+    icn.quantile_grid(scenarios, 0.5, y.data());
+    engine.conditional_losses(y.data(), scenarios, losses.data(), 1);
+    engine.conditional_losses(y.data(), scenarios, losses_threaded.data(), 4);
+    vector<uint64_t> counts(bins), counts_threaded(bins);
+    engine.loss_histogram(y.data(), scenarios, width, bins, counts.data(), 1);
+    engine.loss_histogram(y.data(), scenarios, width, bins, counts_threaded.data(), 3);
+    bool consistent = losses == losses_threaded && counts == counts_threaded;
+    
+    // Negative (hedged) losses land in the first bin; empty or zero-width
+    // histograms are rejected
+    vector<double> hedge(n, -1.0 / n);
+    const auto short_book = VasicekLossEngine::one_factor(pds.data(), hedge.data(), rhos.data(), n);
+    vector<uint64_t> short_counts(4);
+    short_book.loss_histogram(y.data(), 1000, width, 4, short_counts.data(), 2);
+    consistent = consistent && short_counts[0] == 1000;
+    for (double bad_width : {0.0, -1.0, numeric_limits<double>::quiet_NaN()}) {
+        try {
+            short_book.loss_histogram(y.data(), 10, bad_width, 4, short_counts.data(), 1);
+            consistent = false;
+        } catch (const invalid_argument&) {}
+    }
+    try {
+        short_book.loss_histogram(y.data(), 10, width, 0, short_counts.data(), 1);
+        consistent = false;
+    } catch (const invalid_argument&) {}
+    
+    // Loadings on or outside the unit ball leave no idiosyncratic variance
+    for (double bad_rho : {1.0, 1.5, numeric_limits<double>::quiet_NaN()}) {
+        try {
+            VasicekLossEngine::one_factor(pds.data(), exposure.data(), &bad_rho, 1);
+            consistent = false;
+        } catch (const invalid_argument&) {}
+    }
+    const double outside[2] = {0.8, 0.6};
+    try {
+        VasicekLossEngine(pds.data(), exposure.data(), outside, 1, 2);
+        consistent = false;
+    } catch (const invalid_argument&) {}
+    
+    double max_cdf_error = 0.0;
+    uint64_t cumulative = 0;
+    for (size_t k = 0; k + 1 < bins; ++k) {
+        cumulative += counts[k];
+        const double x = (k + 1) * width;
+        const double vasicek = cdf((sqrt(1.0 - rho) * icn(x) - icn(pd)) / sqrt(rho));
+        max_cdf_error = max(max_cdf_error, abs(double(cumulative) / scenarios - vasicek));
+    }
+    
+    cout << "Max relative error (conditional PD): " << scientific << setprecision(6) << max_error << "\n";
+    cout << "Max loss CDF error: " << max_cdf_error << "\n";
+    bool passed = max_error < 1e-14 && max_cdf_error < 1e-4 && consistent;
+    cout << "Vasicek loss test: " << (passed ? "PASS" : "FAIL") << "\n";
+}
+
+// Benchmark scalar performance
+void benchmark_scalar() {
+    cout << "\n=== Scalar Performance Benchmark ===\n";
+    
+    const int n_calls = 10000000;
+    random_device rd;
+    mt19937 gen(42);
+    uniform_real_distribution<double> dist(1e-10, 1.0 - 1e-10);
+    
+    // Generate test data
+    vector<double> x_values(n_calls);
+    for (int i = 0; i < n_calls; ++i) {
+        x_values[i] = dist(gen);
+    }
+    
+    // Benchmark optimized version
+    InverseCumulativeNormal icn_opt;
+    Timer timer;
+    
+    timer.start();
+    double sum_opt = 0.0;
+    for (int i = 0; i < n_calls; ++i) {
+        sum_opt += icn_opt(x_values[i]);
+    }
+    double time_opt_ns = timer.elapsed_ns() / n_calls;
+    
+    cout << fixed << setprecision(2);
+    cout << "Optimized implementation:\n";
+    cout << "  Time per call: " << time_opt_ns << " ns\n";
+    cout << "  Throughput: " << (1e9 / time_opt_ns) / 1e6 << " M calls/sec\n";
+    cout << "  (sum = " << sum_opt << " to prevent optimization)\n";
+}
+
+// Benchmark vector performance
+void benchmark_vector() {
+    cout << "\n=== Vector Performance Benchmark ===\n";
+    
+    const int n_elements = 1000000;
+    random_device rd;
+    mt19937 gen(42);
+    uniform_real_distribution<double> dist(1e-10, 1.0 - 1e-10);
+    
+    vector<double> x_in(n_elements);
+    vector<double> z_out(n_elements);
+    
+    for (int i = 0; i < n_elements; ++i) {
+        x_in[i] = dist(gen);
+    }
+    
+    InverseCumulativeNormal icn;
+    Timer timer;
+    
+    // Measure vector overload
+    timer.start();
+    icn(x_in.data(), z_out.data(), n_elements);
+    double time_vector_ms = timer.elapsed_ms();
+    
+    // Measure naive loop
+    timer.start();
+    for (int i = 0; i < n_elements; ++i) {
+        z_out[i] = icn(x_in[i]);
+    }
+    double time_naive_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "Vector overload: " << time_vector_ms << " ms\n";
+    cout << "Naive loop:      " << time_naive_ms << " ms\n";
+    cout << "Speedup:         " << (time_naive_ms / time_vector_ms) << "x\n";
+}
+
+// Benchmark grid and sorted-input quantiles against the generic batch path
+void benchmark_grid() {
+    cout << "\n=== Grid / Sorted Input Benchmark ===\n";
+    
+    const size_t n = 1000000;
+    vector<double> x(n), z(n);
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = (double(i) + 0.5) / double(n);
+    }
+    
+    InverseCumulativeNormal icn;
+    Timer timer;
+    
+    timer.start();
+    icn(x.data(), z.data(), n);
+    double time_generic_ms = timer.elapsed_ms();
+    
+    timer.start();
+    icn.quantile_grid(n, 0.5, z.data());
+    double time_grid_ms = timer.elapsed_ms();
+    
+    // Sorted random input through the warm-started batch
+    mt19937 gen(42);
+    uniform_real_distribution<double> dist(1e-10, 1.0 - 1e-10);
+    for (auto& v : x) v = dist(gen);
+    sort(x.begin(), x.end());
+    
+    timer.start();
+    icn(x.data(), z.data(), n);
+    double time_sorted_generic_ms = timer.elapsed_ms();
+    
+    timer.start();
+    icn.warm_start(x.data(), z.data(), n);
+    double time_warm_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "Generic batch:  " << time_generic_ms << " ms\n";
+    cout << "quantile_grid:  " << time_grid_ms << " ms\n";
+    cout << "Speedup:        " << (time_generic_ms / time_grid_ms) << "x\n";
+    cout << "Sorted input, generic batch: " << time_sorted_generic_ms << " ms\n";
+    cout << "Sorted input, warm_start:    " << time_warm_ms << " ms\n";
+    cout << "Speedup:                     " << (time_sorted_generic_ms / time_warm_ms) << "x\n";
+}
+
+// Benchmark table-driven 16/32-bit codes against the generic batch
+void benchmark_quantized() {
+    cout << "\n=== Quantized Uniform Benchmark ===\n";
+    
+    const size_t n = 1000000;
+    mt19937 gen(42);
+    vector<uint16_t> c16(n);
+    vector<uint32_t> c32(n);
+    vector<double> x(n), z(n);
+    for (size_t i = 0; i < n; ++i) {
+        c32[i] = uint32_t(gen());
+        c16[i] = uint16_t(c32[i] >> 16);
+        x[i] = (c32[i] + 0.5) * 0x1p-32;
+    }
+    
+    InverseCumulativeNormal icn;
+    QuantizedInverseCumulativeNormal qicn;
+    qicn.from_u16(c16.data(), z.data(), 1);  // build tables outside the timing
+    qicn.from_u32(c32.data(), z.data(), 1);
+    Timer timer;
+    
+    timer.start();
+    icn(x.data(), z.data(), n);
+    double time_generic_ms = timer.elapsed_ms();
+    
+    timer.start();
+    qicn.from_u16(c16.data(), z.data(), n);
+    double time_16_ms = timer.elapsed_ms();
+    
+    timer.start();
+    qicn.from_u32(c32.data(), z.data(), n);
+    double time_32_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "Generic batch: " << time_generic_ms << " ms\n";
+    cout << "16-bit table:  " << time_16_ms << " ms (" << time_generic_ms / time_16_ms << "x)\n";
+    cout << "32-bit table:  " << time_32_ms << " ms (" << time_generic_ms / time_32_ms << "x)\n";
+}
+
+// Benchmark repeated confidence levels: generic batch vs deduplicated vs cached
+void benchmark_quantile_cache() {
+    cout << "\n=== Repeated Probability Benchmark ===\n";
+    
+    const size_t n = 1000000;
+    const double levels[] = {0.05, 0.01, 0.005, 0.001};
+    mt19937 gen(42);
+    vector<double> x(n), z(n);
+    for (auto& v : x) v = levels[gen() % 4];
+    
+    InverseCumulativeNormal icn;
+    QuantileCache cache(icn);
+    cache(x.data(), z.data(), 1);  // warm the cache outside the timing
+    Timer timer;
+    
+    timer.start();
+    icn(x.data(), z.data(), n);
+    double time_generic_ms = timer.elapsed_ms();
+    
+    timer.start();
+    deduplicated(icn, x.data(), z.data(), n);
+    double time_dedup_ms = timer.elapsed_ms();
+    
+    timer.start();
+    cache(x.data(), z.data(), n);
+    double time_cache_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "Generic batch: " << time_generic_ms << " ms\n";
+    cout << "Deduplicated:  " << time_dedup_ms << " ms (" << time_generic_ms / time_dedup_ms << "x)\n";
+    cout << "Cached:        " << time_cache_ms << " ms (" << time_generic_ms / time_cache_ms << "x)\n";
+}
+
+// Benchmark the tail seed t = sqrt(-2 log m) with the table-driven log against libm
+void benchmark_tail_seed() {
+    cout << "\n=== Tail Seed Log Benchmark ===\n";
+    
+    // m log-uniform over the lower tail, down to 1e-300
+    const size_t n = 1000000;
+    mt19937 gen(42);
+    uniform_real_distribution<double> dist(log(1e-300), log(0.02425));
+    vector<double> m(n), t(n);
+    for (auto& v : m) v = exp(dist(gen));
+    
+    Timer timer;
+    double time_libm_ms = 1e30, time_table_ms = 1e30;
+    double max_diff = 0.0;
+    for (int run = 0; run < 5; ++run) {
+        timer.start();
+        for (size_t i = 0; i < n; ++i) t[i] = sqrt(-2.0 * log(m[i]));
+        time_libm_ms = min(time_libm_ms, timer.elapsed_ms());
+        const double t_last = t[n - 1];
+        
+        timer.start();
+        for (size_t i = 0; i < n; ++i) t[i] = sqrt(-2.0 * detail::log_core(m[i]));
+        time_table_ms = min(time_table_ms, timer.elapsed_ms());
+        max_diff = max(max_diff, abs(t[n - 1] - t_last) / t_last);
+    }
+    
+    cout << fixed << setprecision(2);
+    cout << "std::log seed:    " << time_libm_ms << " ms\n";
+    cout << "log_core seed:    " << time_table_ms << " ms\n";
+    cout << "Speedup:          " << (time_libm_ms / time_table_ms) << "x"
+         << (max_diff < 1e-15 ? "" : " (seeds differ)") << "\n";
+}
+
+// Benchmark the segmented engine against the generic batch path
+void benchmark_segmented() {
+    cout << "\n=== Segmented Engine Benchmark ===\n";
+    
+    const size_t n = 1000000;
+    mt19937 gen(42);
+    uniform_real_distribution<double> dist(1e-10, 1.0 - 1e-10);
+    vector<double> x(n), z(n);
+    for (auto& v : x) v = dist(gen);
+    
+    InverseCumulativeNormal icn;
+    Timer timer;
+    
+    timer.start();
+    icn(x.data(), z.data(), n);
+    double time_generic_ms = timer.elapsed_ms();
+    
+    timer.start();
+    icn.segmented(x.data(), z.data(), n);
+    double time_segmented_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "Generic batch: " << time_generic_ms << " ms\n";
+    cout << "Segmented:     " << time_segmented_ms << " ms\n";
+    cout << "Speedup:       " << (time_generic_ms / time_segmented_ms) << "x\n";
+}
+
+// Benchmark per-element and broadcast transforms against one object per element
+void benchmark_transform() {
+    cout << "\n=== Parameter Transform Benchmark ===\n";
+    
+    const size_t n = 1000000;
+    mt19937 gen(42);
+    uniform_real_distribution<double> prob(0.0, 1.0), loc(-1.0, 1.0), scale(0.5, 2.0);
+    vector<double> x(n), mu(n), sigma(n), z(n);
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = prob(gen);
+        mu[i] = loc(gen);
+        sigma[i] = scale(gen);
+    }
+    
+    InverseCumulativeNormal icn;
+    Timer timer;
+    
+    timer.start();
+    for (size_t i = 0; i < n; ++i) {
+        z[i] = InverseCumulativeNormal(mu[i], sigma[i])(x[i]);
+    }
+    double time_objects_ms = timer.elapsed_ms();
+    
+    timer.start();
+    icn.transform(x.data(), mu.data(), sigma.data(), z.data(), n);
+    double time_transform_ms = timer.elapsed_ms();
+    
+    timer.start();
+    icn.transform(0.99, mu.data(), sigma.data(), z.data(), n);
+    double time_broadcast_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "Per-element objects: " << time_objects_ms << " ms\n";
+    cout << "Transform:           " << time_transform_ms << " ms (" << time_objects_ms / time_transform_ms << "x)\n";
+    cout << "Broadcast:           " << time_broadcast_ms << " ms (" << time_objects_ms / time_broadcast_ms << "x)\n";
+}
+
+// Benchmark the quantile matrix against per-element quantiles
+void benchmark_quantile_matrix() {
+    cout << "\n=== Quantile Matrix Benchmark ===\n";
+    
+    const double levels[] = {0.9, 0.95, 0.975, 0.99, 0.995, 0.999, 0.9995, 0.9999};
+    const size_t n_levels = 8, n = 131072;  // 8 MB of output: streaming stores
+    mt19937 gen(42);
+    uniform_real_distribution<double> loc(-1.0, 1.0), scale(0.5, 2.0);
+    vector<double> mu(n), sigma(n), x(n), matrix(n_levels * n);
+    for (size_t i = 0; i < n; ++i) {
+        mu[i] = loc(gen);
+        sigma[i] = scale(gen);
+    }
+    
+    InverseCumulativeNormal icn;
+    Timer timer;
+    
+    timer.start();
+    for (size_t k = 0; k < n_levels; ++k) {
+        fill(x.begin(), x.end(), levels[k]);
+        icn.transform(x.data(), mu.data(), sigma.data(), matrix.data() + k * n, n);
+    }
+    double time_full_ms = timer.elapsed_ms();
+    
+    timer.start();
+    icn.quantile_matrix(levels, n_levels, mu.data(), sigma.data(), n, matrix.data());
+    double time_matrix_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "Per-element quantiles: " << time_full_ms << " ms\n";
+    cout << "Quantile matrix:       " << time_matrix_ms << " ms (" << time_full_ms / time_matrix_ms << "x)\n";
+}
+
+// Benchmark the strided batch against packing, batching and unpacking
+void benchmark_strided() {
+    cout << "\n=== Strided Batch Benchmark ===\n";
+    
+    const size_t n = 1000000, stride = 4;
+    mt19937 gen(42);
+    uniform_real_distribution<double> dist(0.0, 1.0);
+    vector<double> rows(n * stride), packed(n), z(n);
+    for (auto& v : rows) v = dist(gen);
+    
+    InverseCumulativeNormal icn;
+    Timer timer;
+    
+    timer.start();
+    for (size_t i = 0; i < n; ++i) packed[i] = rows[i * stride];
+    icn(packed.data(), z.data(), n);
+    for (size_t i = 0; i < n; ++i) rows[i * stride + 1] = z[i];
+    double time_packed_ms = timer.elapsed_ms();
+    
+    timer.start();
+    icn(rows.data(), stride, rows.data() + 1, stride, n);
+    double time_strided_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "Pack, batch, unpack: " << time_packed_ms << " ms\n";
+    cout << "Strided batch:       " << time_strided_ms << " ms (" << time_packed_ms / time_strided_ms << "x)\n";
+}
+
+// Benchmark tile streaming against full arrays for a payoff-only Monte Carlo
+void benchmark_generate_tiles() {
+    cout << "\n=== Tile Streaming Benchmark ===\n";
+    
+    // Payoff-only Monte Carlo: each normal is read once
+    const size_t n = 1000000;
+    const double spot = 100.0, strike = 105.0;
+    Philox4x32 rng(42);
+    InverseCumulativeNormal icn(-0.02, 0.2);
+    Timer timer;
+    
+    timer.start();
+    vector<double> u(n), z(n);
+    for (auto& v : u) v = Philox4x32::to_uniform(rng());
+    icn(u.data(), z.data(), n);
+    double payoff_full = 0.0;
+    for (size_t i = 0; i < n; ++i) payoff_full += max(spot * exp(z[i]) - strike, 0.0);
+    double time_full_ms = timer.elapsed_ms();
+    
+    rng = Philox4x32(42);
+    timer.start();
+    double payoff_tiles = 0.0;
+    icn.generate_tiles(n,
+        [&](double* tile, size_t m) {
+            for (size_t i = 0; i < m; ++i) tile[i] = Philox4x32::to_uniform(rng());
+        },
+        512,
+        [&](const double* tile, size_t m) {
+            for (size_t i = 0; i < m; ++i) payoff_tiles += max(spot * exp(tile[i]) - strike, 0.0);
+        });
+    double time_tiles_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "Full arrays: " << time_full_ms << " ms\n";
+    cout << "Tiles:       " << time_tiles_ms << " ms (" << time_full_ms / time_tiles_ms << "x)"
+         << (payoff_tiles == payoff_full ? "" : " (payoffs differ)") << "\n";
+}
+
+// Benchmark batch Phi and log Phi against a std::erfc loop
+void benchmark_cumulative_normal() {
+    cout << "\n=== Cumulative Normal Benchmark ===\n";
+    
+    const size_t n = 1000000;
+    mt19937 gen(42);
+    normal_distribution<double> dist(0.0, 1.5);
+    vector<double> z(n), p(n);
+    for (auto& v : z) v = dist(gen);
+    
+    CumulativeNormal cdf;
+    Timer timer;
+    
+    timer.start();
+    for (size_t i = 0; i < n; ++i) {
+        p[i] = 0.5 * erfc(-z[i] * M_SQRT1_2);
+    }
+    double time_std_ms = timer.elapsed_ms();
+    
+    timer.start();
+    cdf(z.data(), p.data(), n);
+    double time_batch_ms = timer.elapsed_ms();
+    
+    timer.start();
+    cdf.log_value(z.data(), p.data(), n);
+    double time_log_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "std::erfc loop: " << time_std_ms << " ms (" << time_std_ms * 1e6 / n << " ns/call)\n";
+    cout << "Batch Phi:      " << time_batch_ms << " ms (" << time_std_ms / time_batch_ms << "x)\n";
+    cout << "Batch log Phi:  " << time_log_ms << " ms\n";
+}
+
+// Benchmark the joint quantile and density against a quantile then exp
+void benchmark_quantile_and_density() {
+    cout << "\n=== Quantile and Density Benchmark ===\n";
+    
+    const size_t n = 1000000;
+    mt19937 gen(42);
+    uniform_real_distribution<double> dist(0.0, 1.0);
+    vector<double> x(n), z(n), pdf(n);
+    for (auto& v : x) v = dist(gen);
+    
+    InverseCumulativeNormal icn;
+    constexpr double INV_SQRT_2PI = 0.398942280401432677939946059934381868475858631164934657;
+    Timer timer;
+    
+    timer.start();
+    icn(x.data(), z.data(), n);
+    for (size_t i = 0; i < n; ++i) pdf[i] = INV_SQRT_2PI * exp(-0.5 * z[i] * z[i]);
+    double time_separate_ms = timer.elapsed_ms();
+    
+    timer.start();
+    icn.quantile_and_density(x.data(), z.data(), pdf.data(), n);
+    double time_joint_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "Quantile then exp: " << time_separate_ms << " ms\n";
+    cout << "Joint:             " << time_joint_ms << " ms (" << time_separate_ms / time_joint_ms << "x)\n";
+}
+
+// Benchmark forward partials and the adjoint sweep against values only
+void benchmark_probit_ad() {
+    cout << "\n=== Probit AD Benchmark ===\n";
+    
+    const size_t n = 1000000;
+    mt19937 gen(42);
+    uniform_real_distribution<double> dist(0.0, 1.0);
+    vector<double> x(n), z(n), dz_dx(n), z_bar(n, 1.0), x_bar(n, 0.0);
+    for (auto& v : x) v = dist(gen);
+    
+    InverseCumulativeNormal icn;
+    Timer timer;
+    
+    timer.start();
+    icn(x.data(), z.data(), n);
+    double time_value_ms = timer.elapsed_ms();
+    
+    timer.start();
+    quantile_forward(icn, x.data(), z.data(), dz_dx.data(), n);
+    double time_forward_ms = timer.elapsed_ms();
+    
+    timer.start();
+    quantile_adjoint(z_bar.data(), dz_dx.data(), x_bar.data(), n);
+    double time_adjoint_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "Values only:           " << time_value_ms << " ms\n";
+    cout << "Forward with partials: " << time_forward_ms << " ms\n";
+    cout << "Adjoint sweep:         " << time_adjoint_ms << " ms\n";
+}
+
+// Benchmark Student-t quantiles across nu against the normal
+void benchmark_student_t() {
+    cout << "\n=== Student-t Quantile Benchmark ===\n";
+    
+    const size_t n = 1000000;
+    mt19937 gen(42);
+    uniform_real_distribution<double> dist(0.0, 1.0);
+    vector<double> x(n), t(n);
+    for (auto& v : x) v = dist(gen);
+    
+    InverseCumulativeNormal icn;
+    Timer timer;
+    
+    timer.start();
+    icn(x.data(), t.data(), n);
+    double time_normal_ms = timer.elapsed_ms();
+    cout << fixed << setprecision(2);
+    cout << "Normal:           " << time_normal_ms << " ms\n";
+    
+    for (double nu : {3.5, 4.0, 5000.0}) {
+        InverseCumulativeStudentT student(nu);
+        timer.start();
+        student(x.data(), t.data(), n);
+        double time_ms = timer.elapsed_ms();
+        cout << "Student-t nu = " << setw(4) << nu << ": " << time_ms << " ms (" << time_ms * 1e6 / n << " ns/call)\n";
+    }
+}
+
+// Benchmark gamma quantiles per shape and with grouped shapes
+void benchmark_gamma() {
+    cout << "\n=== Gamma Quantile Benchmark ===\n";
+    
+    const size_t n = 1000000;
+    mt19937 gen(42);
+    uniform_real_distribution<double> dist(0.0, 1.0);
+    vector<double> x(n), y(n), shape(n);
+    for (auto& v : x) v = dist(gen);
+    for (size_t i = 0; i < n; ++i) shape[i] = 0.5 + double(i / 1000 % 50);
+    
+    Timer timer;
+    cout << fixed << setprecision(2);
+    for (double a : {0.5, 3.0, 100.0}) {
+        InverseCumulativeGamma gamma(a);
+        timer.start();
+        gamma(x.data(), y.data(), n);
+        double time_ms = timer.elapsed_ms();
+        cout << "Shape " << setw(5) << a << ":        " << time_ms << " ms (" << time_ms * 1e6 / n << " ns/call)\n";
+    }
+    
+    timer.start();
+    InverseCumulativeGamma::quantiles_by_shape(x.data(), shape.data(), y.data(), n);
+    double time_mixed_ms = timer.elapsed_ms();
+    cout << "Grouped shapes:      " << time_mixed_ms << " ms (" << time_mixed_ms * 1e6 / n << " ns/call)\n";
+}
+
+// Benchmark truncated normal sampling in the body and the far tail
+void benchmark_truncated_normal() {
+    cout << "\n=== Truncated Normal Benchmark ===\n";
+    
+    const size_t n = 1000000;
+    mt19937 gen(42);
+    uniform_real_distribution<double> dist(0.0, 1.0);
+    vector<double> u(n), y(n);
+    for (auto& v : u) v = dist(gen);
+    
+    InverseCumulativeNormal icn;
+    Timer timer;
+    timer.start();
+    icn(u.data(), y.data(), n);
+    double time_plain_ms = timer.elapsed_ms();
+    
+    TruncatedNormal body(-1.0, 2.0);
+    timer.start();
+    body(u.data(), y.data(), n);
+    double time_body_ms = timer.elapsed_ms();
+    
+    TruncatedNormal tail(40.0, 41.0);
+    timer.start();
+    tail(u.data(), y.data(), n);
+    double time_tail_ms = timer.elapsed_ms();
+    
+    cout << fixed << setprecision(2);
+    cout << "Untruncated:         " << time_plain_ms << " ms (" << time_plain_ms * 1e6 / n << " ns/call)\n";
+    cout << "[-1, 2]:             " << time_body_ms << " ms (" << time_body_ms * 1e6 / n << " ns/call)\n";
+    cout << "[40, 41] (log path): " << time_tail_ms << " ms (" << time_tail_ms * 1e6 / n << " ns/call)\n";
+}
+
+// Benchmark copula default counting on uniforms against normals
+void benchmark_gaussian_copula() {
+    cout << "\n=== Gaussian Copula Benchmark ===\n";
+    
+    // One-factor credit portfolio: count defaults over scenarios x obligors
+    const size_t obligors = 10000, scenarios = 200;
+    vector<double> loadings(obligors), pd(obligors), threshold(obligors);
+    for (size_t d = 0; d < obligors; ++d) {
+        loadings[d] = 0.3 + 0.2 * double(d % 5) / 4.0;
+        pd[d] = 0.001 + 0.01 * double(d % 10);
+    }
+    GaussianCopula copula(loadings.data(), obligors, 1, 42);
+    
+    Timer timer;
+    timer.start();
+    GaussianCopula::thresholds(pd.data(), threshold.data(), obligors);
+    double time_thresholds_ms = timer.elapsed_ms();
+    
+    size_t defaults = 0;
+    timer.start();
+    copula.generate(scenarios, [&](size_t, size_t rows, size_t c0, size_t cols, const double* tile) {
+        for (size_t r = 0; r < rows; ++r) {
+            for (size_t c = 0; c < cols; ++c) defaults += tile[r * cols + c] < pd[c0 + c];
+        }
+    });
+    double time_uniform_ms = timer.elapsed_ms();
+    
+    vector<double> tile(scenarios * 64);
+    size_t defaults_normal = 0;
+    timer.start();
+    for (size_t c0 = 0; c0 < obligors; c0 += 64) {
+        const size_t c1 = min(obligors, c0 + 64);
+        copula.fill_normals(0, scenarios, c0, c1, tile.data());
+        for (size_t r = 0; r < scenarios; ++r) {
+            for (size_t c = c0; c < c1; ++c) defaults_normal += tile[r * (c1 - c0) + c - c0] < threshold[c];
+        }
+    }
+    double time_normal_ms = timer.elapsed_ms();
+    
+    const double cells = double(obligors * scenarios);
+    cout << fixed << setprecision(2);
+    cout << "Thresholds (" << obligors << "): " << time_thresholds_ms << " ms\n";
+    cout << "Uniforms, u < PD:    " << time_uniform_ms << " ms (" << time_uniform_ms * 1e6 / cells << " ns/cell)\n";
+    cout << "Normals, X < Phi^-1: " << time_normal_ms << " ms (" << time_normal_ms * 1e6 / cells << " ns/cell)\n";
+    cout << "Defaults: " << defaults << " / " << defaults_normal << "\n";
+}
+
+// Benchmark Vasicek conditional losses across thread counts
+void benchmark_vasicek_loss() {
+    cout << "\n=== Vasicek Loss Benchmark ===\n";
+    
+    const size_t obligors = 20000, scenarios = 1000, factors = 2;
+    vector<double> pd(obligors), exposure(obligors), loadings(obligors * factors);
+    for (size_t i = 0; i < obligors; ++i) {
+        pd[i] = 0.001 + 0.01 * double(i % 10);
+        exposure[i] = 1.0 + double(i % 7);
+        loadings[i * factors] = 0.3 + 0.02 * double(i % 5);
+        loadings[i * factors + 1] = 0.1 * double(i % 3);
+    }
+    vector<double> y(scenarios * factors), losses(scenarios);
+    generate_normals(PseudoRandomNormals(9, factors), scenarios, y.data(), 1);
+    
+    Timer timer;
+    timer.start();
+    VasicekLossEngine engine(pd.data(), exposure.data(), loadings.data(), obligors, factors);
+    double time_setup_ms = timer.elapsed_ms();
+    
+    const double cells = double(obligors * scenarios);
+    cout << fixed << setprecision(2);
+    cout << "Setup (" << obligors << " thresholds): " << time_setup_ms << " ms\n";
+    for (unsigned threads : {1u, 4u}) {
+        timer.start();
+        engine.conditional_losses(y.data(), scenarios, losses.data(), threads);
+        double time_ms = timer.elapsed_ms();
+        cout << threads << " thread(s):          " << time_ms << " ms (" << time_ms * 1e6 / cells << " ns/obligor-scenario)\n";
+    }
 }
 
 int main() {
@@ -246,10 +2003,53 @@ int main() {
     test_roundtrip();
     test_monotonicity();
     test_derivative();
+    test_parallel_streams();
+    test_latin_hypercube();
+    test_quantile_grid();
+    test_warm_start();
+    test_log_probability();
+    test_survival_probability();
+    test_from_bits();
+    test_log_kernel();
+    test_quantized();
+    test_segmented();
+    test_quantile_cache();
+#if defined(QUANT_ENABLE_CONSTEXPR)
+    test_constexpr();
+#endif
+    test_transform();
+    test_quantile_matrix();
+    test_strided_indexed();
+    test_generate_tiles();
+    test_cumulative_normal();
+    test_quantile_and_density();
+    test_probit_ad();
+    test_student_t();
+    test_gamma();
+    test_truncated_normal();
+    test_gaussian_copula();
+    test_vasicek_loss();
     
     // Performance benchmarks
     benchmark_scalar();
     benchmark_vector();
+    benchmark_grid();
+    benchmark_quantized();
+    benchmark_tail_seed();
+    benchmark_segmented();
+    benchmark_quantile_cache();
+    benchmark_transform();
+    benchmark_quantile_matrix();
+    benchmark_strided();
+    benchmark_generate_tiles();
+    benchmark_cumulative_normal();
+    benchmark_quantile_and_density();
+    benchmark_probit_ad();
+    benchmark_student_t();
+    benchmark_gamma();
+    benchmark_truncated_normal();
+    benchmark_gaussian_copula();
+    benchmark_vasicek_loss();
     
     cout << "\n======================================================================\n";
     cout << "All tests complete!\n";